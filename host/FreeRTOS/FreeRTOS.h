@@ -0,0 +1,72 @@
+/**
+ * \defgroup host Host build
+ * Linux port of the FreeRTOS API subset and board support used to run the framework on a PC
+ */
+
+/**
+ * \ingroup host
+ * @file FreeRTOS.h
+ *
+ * Host replacement of the FreeRTOS base header
+ *
+ * Provides the FreeRTOS types and port macros used by the framework. Tasks and synchronization primitives are
+ * implemented on top of std::thread, std::mutex and std::condition_variable in port.cpp. The kernel sources in the
+ * FreeRTOS directory are not used by the host build.
+ *
+ * \date 16. 10. 2026
+ */
+
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <cstddef>
+#include <cstdint>
+
+/// Tick count type, one tick equals one millisecond
+typedef uint32_t TickType_t;
+/// Signed base type, matches the ARM_CM4F port
+typedef long BaseType_t;
+/// Unsigned base type, matches the ARM_CM4F port
+typedef unsigned long UBaseType_t;
+/// Stack item type
+typedef uint32_t StackType_t;
+
+#define pdFALSE			( ( BaseType_t ) 0 )
+#define pdTRUE			( ( BaseType_t ) 1 )
+#define pdPASS			( pdTRUE )
+#define pdFAIL			( pdFALSE )
+
+#define configTICK_RATE_HZ		( ( TickType_t ) 1000 )
+#define configMAX_PRIORITIES	( 5 )
+
+#define portMAX_DELAY			( ( TickType_t ) 0xffffffffUL )
+#define portTICK_PERIOD_MS		( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+
+/**
+ * Enter host critical section
+ *
+ * Critical sections are emulated by single process wide recursive lock.
+ */
+void vPortEnterCritical();
+
+/**
+ * Exit host critical section
+ */
+void vPortExitCritical();
+
+#define portENTER_CRITICAL()		vPortEnterCritical()
+#define portEXIT_CRITICAL()			vPortExitCritical()
+#define portDISABLE_INTERRUPTS()	vPortEnterCritical()
+#define portENABLE_INTERRUPTS()		vPortExitCritical()
+
+#define configASSERT( x ) if( ( x ) == 0 ) { vAssertCalled( __FILE__, __LINE__ ); }
+
+/**
+ * Report failed configASSERT and stop the process
+ *
+ * @param file Source file name
+ * @param line Source file line
+ */
+void vAssertCalled(const char *file, unsigned long line);
+
+#endif // FREERTOS_H
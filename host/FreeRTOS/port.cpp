@@ -0,0 +1,377 @@
+/**
+ * \ingroup host
+ * @file port.cpp
+ *
+ * Host implementation of the FreeRTOS API subset used by the framework
+ *
+ * \date 16. 10. 2026
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+#include <pthread.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace {
+	/**
+	 * Host task control block
+	 */
+	struct HostTask {
+		/// Task entry point
+		TaskFunction_t code;
+		/// Task entry point parameter
+		void *parameters;
+		/// Task name
+		char name[16];
+		/// Task priority
+		UBaseType_t priority;
+		/// Stack depth in words
+		uint16_t stackDepth;
+		/// Thread stack
+		uint8_t *stack;
+		/// Thread stack top when the task code was entered, NULL before
+		uint8_t * volatile entry = NULL;
+		/// Whenever the task was deleted
+		bool deleted = false;
+		/// Whenever the task is suspended
+		bool suspended = false;
+	};
+
+	/**
+	 * Host semaphore
+	 */
+	struct HostSemaphore {
+		/// Semaphore value lock
+		std::mutex mutex;
+		/// Signaled when semaphore is given
+		std::condition_variable given;
+		/// Current semaphore value
+		UBaseType_t count;
+		/// Maximal semaphore value
+		UBaseType_t max;
+	};
+
+	/// Scheduler state lock
+	std::mutex schedulerMutex;
+	/// Signaled when scheduler state or any task state changes
+	std::condition_variable schedulerChanged;
+	/// Whenever the scheduler was started
+	bool schedulerRunning = false;
+	/// Whenever the scheduler was ended
+	bool schedulerEnded = false;
+
+	/// Lock emulating disabled interrupts
+	std::recursive_mutex criticalMutex;
+	/// Lock emulating suspended scheduler
+	std::recursive_mutex suspendAllMutex;
+
+	/// Number of tasks not deleted
+	UBaseType_t taskCount = 0;
+	/// Stack words of the tasks not deleted
+	size_t stackWords = 0;
+	/// Number of times a task blocked
+	std::atomic<uint32_t> blockCount { 0 };
+
+	/// Host thread stack size, way larger than any target task stack
+	const size_t THREAD_STACK_SIZE = 256 * 1024;
+	/// Byte the thread stacks are painted with, same as on the target
+	const uint8_t STACK_FILL_BYTE = 0xa5;
+
+	/// Tick count reference point
+	const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+	/// Task control block of the calling thread
+	thread_local HostTask *currentTask = NULL;
+
+	/**
+	 * Block calling task forever
+	 *
+	 * Used for deleted tasks as running threads cannot be terminated safely.
+	 */
+	void parkForever() {
+		std::unique_lock<std::mutex> lock(schedulerMutex);
+		schedulerChanged.wait(lock, [] {return false;});
+	}
+
+	/**
+	 * Check calling task state
+	 *
+	 * Parks the deleted tasks and blocks the suspended ones until resumed.
+	 */
+	void checkCurrentTask() {
+		if(!currentTask)
+			return;
+
+		std::unique_lock<std::mutex> lock(schedulerMutex);
+		if(currentTask->deleted) {
+			lock.unlock();
+			parkForever();
+		}
+		schedulerChanged.wait(lock, [] {return !currentTask->suspended;});
+	}
+
+	/**
+	 * Thread entry point
+	 *
+	 * Waits for the scheduler start and runs the task code.
+	 *
+	 * @param data Task control block
+	 * @return Nothing
+	 */
+	void *taskThread(void *data) {
+		HostTask *task = static_cast<HostTask*>(data);
+		pthread_setname_np(pthread_self(), task->name);
+
+		{
+			std::unique_lock<std::mutex> lock(schedulerMutex);
+			schedulerChanged.wait(lock, [task] {return schedulerRunning || task->deleted;});
+			if(task->deleted) {
+				// The stack is not freed as the thread still runs on it
+				delete task;
+				return NULL;
+			}
+		}
+
+		currentTask = task;
+		task->entry = static_cast<uint8_t*>(__builtin_frame_address(0));
+		task->code(task->parameters);
+		return NULL;
+	}
+
+	/**
+	 * Get task control block from handle
+	 *
+	 * @param handle Task handle, NULL for the calling task
+	 * @return Task control block
+	 */
+	HostTask *getTask(TaskHandle_t handle) {
+		return handle ? static_cast<HostTask*>(handle) : currentTask;
+	}
+}
+
+void vPortEnterCritical() {
+	criticalMutex.lock();
+}
+
+void vPortExitCritical() {
+	criticalMutex.unlock();
+}
+
+void vAssertCalled(const char *file, unsigned long line) {
+	fprintf(stderr, "FreeRTOS assert failed: %s:%lu\n", file, line);
+	abort();
+}
+
+BaseType_t xTaskCreate(TaskFunction_t pvTaskCode, const char * const pcName, const uint16_t usStackDepth,
+		void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask) {
+	HostTask *task = new HostTask();
+	task->code = pvTaskCode;
+	task->parameters = pvParameters;
+	snprintf(task->name, sizeof(task->name), "%s", pcName);
+	task->priority = uxPriority;
+	task->stackDepth = usStackDepth;
+
+	{
+		std::lock_guard<std::mutex> lock(schedulerMutex);
+		taskCount++;
+		stackWords += usStackDepth;
+	}
+
+	if(pxCreatedTask)
+		*pxCreatedTask = task;
+
+	// Run the thread on painted stack to measure its usage
+	task->stack = static_cast<uint8_t*>(malloc(THREAD_STACK_SIZE));
+	memset(task->stack, STACK_FILL_BYTE, THREAD_STACK_SIZE);
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	pthread_attr_setstack(&attr, task->stack, THREAD_STACK_SIZE);
+	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+	pthread_t thread;
+	const int created = pthread_create(&thread, &attr, taskThread, task);
+	pthread_attr_destroy(&attr);
+	configASSERT(created == 0);
+
+	return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t xTaskToDelete) {
+	HostTask *task = getTask(xTaskToDelete);
+	if(!task)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(schedulerMutex);
+		if(!task->deleted) {
+			taskCount--;
+			stackWords -= task->stackDepth;
+		}
+		task->deleted = true;
+	}
+	schedulerChanged.notify_all();
+
+	if(task == currentTask)
+		parkForever();
+}
+
+void vTaskDelay(const TickType_t xTicksToDelay) {
+	checkCurrentTask();
+	if(xTicksToDelay > 0)
+		blockCount++;
+	std::this_thread::sleep_for(std::chrono::milliseconds(xTicksToDelay * portTICK_PERIOD_MS));
+}
+
+void vTaskDelayUntil(TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement) {
+	*pxPreviousWakeTime += xTimeIncrement;
+	const TickType_t remaining = *pxPreviousWakeTime - xTaskGetTickCount();
+	if(remaining != 0 && remaining <= xTimeIncrement)
+		vTaskDelay(remaining);
+	else
+		checkCurrentTask();
+}
+
+void vTaskSuspend(TaskHandle_t xTaskToSuspend) {
+	HostTask *task = getTask(xTaskToSuspend);
+	if(!task)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(schedulerMutex);
+		task->suspended = true;
+	}
+
+	if(task == currentTask)
+		checkCurrentTask();
+}
+
+void vTaskResume(TaskHandle_t xTaskToResume) {
+	{
+		std::lock_guard<std::mutex> lock(schedulerMutex);
+		static_cast<HostTask*>(xTaskToResume)->suspended = false;
+	}
+	schedulerChanged.notify_all();
+}
+
+UBaseType_t uxTaskPriorityGet(TaskHandle_t xTask) {
+	HostTask *task = getTask(xTask);
+	return task ? task->priority : tskIDLE_PRIORITY;
+}
+
+void vTaskPrioritySet(TaskHandle_t xTask, UBaseType_t uxNewPriority) {
+	HostTask *task = getTask(xTask);
+	if(task)
+		task->priority = uxNewPriority;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+	return currentTask;
+}
+
+TickType_t xTaskGetTickCount() {
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count()
+			/ portTICK_PERIOD_MS;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t xTask) {
+	HostTask *task = getTask(xTask);
+	if(!task || !task->entry)
+		return task ? task->stackDepth : 0;
+
+	// The stack grows down, the first touched byte from the bottom marks the deepest use
+	const uint8_t *deepest = task->stack;
+	while(deepest < task->entry && *deepest == STACK_FILL_BYTE)
+		deepest++;
+	const size_t used = (task->entry - deepest + sizeof(StackType_t) - 1) / sizeof(StackType_t);
+	return used < task->stackDepth ? task->stackDepth - used : 0;
+}
+
+UBaseType_t uxTaskGetNumberOfTasks() {
+	std::lock_guard<std::mutex> lock(schedulerMutex);
+	return taskCount;
+}
+
+void vHostGetStats(HostStats *pxStats) {
+	std::lock_guard<std::mutex> lock(schedulerMutex);
+	pxStats->tasks = taskCount;
+	pxStats->stackBytes = stackWords * sizeof(StackType_t);
+	pxStats->blocks = blockCount;
+}
+
+void vTaskStartScheduler() {
+	std::unique_lock<std::mutex> lock(schedulerMutex);
+	schedulerRunning = true;
+	schedulerChanged.notify_all();
+	schedulerChanged.wait(lock, [] {return schedulerEnded;});
+}
+
+void vTaskEndScheduler() {
+	{
+		std::lock_guard<std::mutex> lock(schedulerMutex);
+		schedulerEnded = true;
+	}
+	schedulerChanged.notify_all();
+}
+
+void vTaskSuspendAll() {
+	suspendAllMutex.lock();
+}
+
+BaseType_t xTaskResumeAll() {
+	suspendAllMutex.unlock();
+	return pdFALSE;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+	return xSemaphoreCreateCounting(1, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t uxMaxCount, UBaseType_t uxInitialCount) {
+	HostSemaphore *sem = new HostSemaphore();
+	sem->count = uxInitialCount;
+	sem->max = uxMaxCount;
+	return sem;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime) {
+	HostSemaphore *sem = static_cast<HostSemaphore*>(xSemaphore);
+	std::unique_lock<std::mutex> lock(sem->mutex);
+
+	auto available = [sem] {return sem->count > 0;};
+	if(!available() && xBlockTime > 0)
+		blockCount++;
+	if(xBlockTime == portMAX_DELAY)
+		sem->given.wait(lock, available);
+	else if(!sem->given.wait_for(lock, std::chrono::milliseconds(xBlockTime * portTICK_PERIOD_MS), available))
+		return pdFALSE;
+
+	sem->count--;
+	return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore) {
+	HostSemaphore *sem = static_cast<HostSemaphore*>(xSemaphore);
+	{
+		std::lock_guard<std::mutex> lock(sem->mutex);
+		if(sem->count >= sem->max)
+			return pdFALSE;
+		sem->count++;
+	}
+	sem->given.notify_one();
+	return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t xSemaphore, BaseType_t *pxHigherPriorityTaskWoken) {
+	if(pxHigherPriorityTaskWoken)
+		*pxHigherPriorityTaskWoken = pdFALSE;
+	return xSemaphoreGive(xSemaphore);
+}
@@ -0,0 +1,65 @@
+/**
+ * \ingroup host
+ * @file semphr.h
+ *
+ * Host replacement of the FreeRTOS semaphore API
+ *
+ * Both mutexes and counting semaphores are implemented as counting semaphores built on std::mutex and
+ * std::condition_variable. The host mutex has no priority inheritance.
+ *
+ * \date 16. 10. 2026
+ */
+
+#ifndef SEMAPHORE_H
+#define SEMAPHORE_H
+
+#include "FreeRTOS.h"
+
+/// Semaphore handle
+typedef void * SemaphoreHandle_t;
+
+/**
+ * Create mutex
+ *
+ * @return Mutex handle
+ */
+SemaphoreHandle_t xSemaphoreCreateMutex();
+
+/**
+ * Create counting semaphore
+ *
+ * @param uxMaxCount Maximal semaphore value
+ * @param uxInitialCount Initial semaphore value
+ * @return Semaphore handle
+ */
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t uxMaxCount, UBaseType_t uxInitialCount);
+
+/**
+ * Take semaphore
+ *
+ * @param xSemaphore Semaphore to take
+ * @param xBlockTime Number of ticks to wait, portMAX_DELAY waits forever
+ * @return pdTRUE when taken, pdFALSE on timeout
+ */
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime);
+
+/**
+ * Give semaphore
+ *
+ * @param xSemaphore Semaphore to give
+ * @return pdTRUE when given, pdFALSE when already at maximum
+ */
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore);
+
+/**
+ * Give semaphore from interrupt
+ *
+ * There are no interrupts on the host, driver stubs call this from ordinary threads.
+ *
+ * @param xSemaphore Semaphore to give
+ * @param pxHigherPriorityTaskWoken Set to pdFALSE, may be NULL
+ * @return pdTRUE when given, pdFALSE when already at maximum
+ */
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t xSemaphore, BaseType_t *pxHigherPriorityTaskWoken);
+
+#endif // SEMAPHORE_H
@@ -0,0 +1,190 @@
+/**
+ * \ingroup host
+ * @file task.h
+ *
+ * Host replacement of the FreeRTOS task API
+ *
+ * Each FreeRTOS task is mapped to one thread. Tasks created before vTaskStartScheduler is called do not run
+ * until the scheduler is started, just like on the target. Priorities are recorded but not enforced as the host
+ * scheduler is used to run the threads. Thread stacks are painted, thus the stack high water mark reports the stack
+ * really used by the task code on the host.
+ *
+ * \date 16. 10. 2026
+ */
+
+#ifndef INC_TASK_H
+#define INC_TASK_H
+
+#include "FreeRTOS.h"
+
+/// Task handle
+typedef void * TaskHandle_t;
+/// Task entry point
+typedef void (*TaskFunction_t)(void *);
+
+#define tskIDLE_PRIORITY			( ( UBaseType_t ) 0U )
+
+#define taskENTER_CRITICAL()		portENTER_CRITICAL()
+#define taskEXIT_CRITICAL()			portEXIT_CRITICAL()
+#define taskDISABLE_INTERRUPTS()	portDISABLE_INTERRUPTS()
+#define taskENABLE_INTERRUPTS()		portENABLE_INTERRUPTS()
+
+/**
+ * Create new task
+ *
+ * @param pvTaskCode Task entry point
+ * @param pcName Task name, used as thread name
+ * @param usStackDepth Stack depth in words, only accounted by the host port
+ * @param pvParameters Parameter passed to the task entry point
+ * @param uxPriority Task priority
+ * @param pxCreatedTask Pointer to store the created task handle to, may be NULL
+ * @return pdPASS on success
+ */
+BaseType_t xTaskCreate(TaskFunction_t pvTaskCode, const char * const pcName, const uint16_t usStackDepth,
+		void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask);
+
+/**
+ * Delete task
+ *
+ * Tasks that were not started yet are removed immediately. Running tasks cannot be stopped from outside on the host,
+ * they are parked at their next kernel call instead.
+ *
+ * @param xTaskToDelete Task to delete, NULL for the calling task
+ */
+void vTaskDelete(TaskHandle_t xTaskToDelete);
+
+/**
+ * Delay the calling task
+ *
+ * @param xTicksToDelay Number of ticks to wait
+ */
+void vTaskDelay(const TickType_t xTicksToDelay);
+
+/**
+ * Delay the calling task until absolute time
+ *
+ * Returns immediately when the wake time has already passed.
+ *
+ * @param pxPreviousWakeTime Time the task was woken last time, updated to the new wake time
+ * @param xTimeIncrement Ticks in between the wake times
+ */
+void vTaskDelayUntil(TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement);
+
+/**
+ * Suspend task
+ *
+ * The calling task is suspended immediately, other tasks are suspended at their next delay.
+ *
+ * @param xTaskToSuspend Task to suspend, NULL for the calling task
+ */
+void vTaskSuspend(TaskHandle_t xTaskToSuspend);
+
+/**
+ * Resume suspended task
+ *
+ * @param xTaskToResume Task to resume
+ */
+void vTaskResume(TaskHandle_t xTaskToResume);
+
+/**
+ * Get task priority
+ *
+ * @param xTask Task to query, NULL for the calling task
+ * @return Task priority
+ */
+UBaseType_t uxTaskPriorityGet(TaskHandle_t xTask);
+
+/**
+ * Set task priority
+ *
+ * The priority is only recorded, host threads are scheduled by the operating system.
+ *
+ * @param xTask Task to modify, NULL for the calling task
+ * @param uxNewPriority New task priority
+ */
+void vTaskPrioritySet(TaskHandle_t xTask, UBaseType_t uxNewPriority);
+
+/**
+ * Get handle of the calling task
+ *
+ * @return Calling task handle or NULL when called outside of a task
+ */
+TaskHandle_t xTaskGetCurrentTaskHandle();
+
+/**
+ * Get tick count
+ *
+ * @return Milliseconds since the process start
+ */
+TickType_t xTaskGetTickCount();
+
+/**
+ * Get stack high water mark
+ *
+ * Host stack frames are larger than target ones, thus the host usage is an upper estimate of the target usage.
+ *
+ * @param xTask Task to query, NULL for the calling task
+ * @return Minimal number of stack words left unused since the task was started, zero when the task used more than its
+ * stack depth
+ */
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t xTask);
+
+/**
+ * Get number of tasks
+ *
+ * @return Number of tasks not deleted
+ */
+UBaseType_t uxTaskGetNumberOfTasks();
+
+/**
+ * Host port runtime statistics
+ *
+ * Not part of the FreeRTOS API, used to compare execution modes on the host.
+ */
+struct HostStats {
+	/// Number of tasks not deleted
+	UBaseType_t tasks;
+	/// Stack memory the tasks would take on the target in bytes
+	size_t stackBytes;
+	/// Number of times a task blocked, each costs a context switch away from and back to the task on the target
+	uint32_t blocks;
+};
+
+/**
+ * Get host port runtime statistics
+ *
+ * Not part of the FreeRTOS API.
+ *
+ * @param pxStats Statistics to fill
+ */
+void vHostGetStats(HostStats *pxStats);
+
+/**
+ * Start scheduler
+ *
+ * Releases all created tasks and blocks until vTaskEndScheduler is called.
+ */
+void vTaskStartScheduler();
+
+/**
+ * End scheduler
+ *
+ * Makes vTaskStartScheduler return. Tasks are left running.
+ */
+void vTaskEndScheduler();
+
+/**
+ * Suspend all tasks
+ *
+ * Emulated by process wide recursive lock. Only tasks that also suspend the scheduler are blocked.
+ */
+void vTaskSuspendAll();
+
+/**
+ * Resume tasks suspended by vTaskSuspendAll
+ *
+ * @return Always pdFALSE as no context switch is requested on the host
+ */
+BaseType_t xTaskResumeAll();
+
+#endif // INC_TASK_H
@@ -0,0 +1,18 @@
+/**
+ * \ingroup host
+ * @file timers.h
+ *
+ * Host replacement of the FreeRTOS software timers header
+ *
+ * Software timers are not used by the framework. The header is present only to satisfy includes.
+ *
+ * \date 16. 10. 2026
+ */
+
+#ifndef TIMERS_H
+#define TIMERS_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#endif // TIMERS_H
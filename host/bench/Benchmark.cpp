@@ -0,0 +1,83 @@
+/**
+ * \ingroup host
+ * @file Benchmark.cpp
+ *
+ * Microbenchmark harness implementation and instrumentation hooks
+ *
+ * \date 16. 10. 2026
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "Benchmark.h"
+
+size_t Benchmark::allocations = 0;
+size_t Benchmark::allocatedBytes = 0;
+size_t Benchmark::copiedBytes = 0;
+const char *Benchmark::filter = NULL;
+
+void Benchmark::setFilter(const char *filter) {
+	Benchmark::filter = filter;
+}
+
+void Benchmark::header() {
+	printf("%-64s %12s %10s %12s %12s\n", "Benchmark", "ns/op", "allocs/op", "alloc B/op", "copied B/op");
+}
+
+bool Benchmark::matches(const char *name) {
+	return filter == NULL || strstr(name, filter) != NULL;
+}
+
+void Benchmark::report(const char *name, size_t ops, long long ns) {
+	printf("%-64s %12.1f %10.2f %12.1f %12.1f\n", name, (double) ns / ops, (double) allocations / ops,
+			(double) allocatedBytes / ops, (double) copiedBytes / ops);
+	fflush(stdout);
+}
+
+// Copy accounting, enabled by -Wl,--wrap=memcpy,--wrap=memmove
+extern "C" {
+	void *__real_memcpy(void *dest, const void *src, size_t n);
+	void *__real_memmove(void *dest, const void *src, size_t n);
+
+	void *__wrap_memcpy(void *dest, const void *src, size_t n) {
+		Benchmark::copiedBytes += n;
+		return __real_memcpy(dest, src, n);
+	}
+
+	void *__wrap_memmove(void *dest, const void *src, size_t n) {
+		Benchmark::copiedBytes += n;
+		return __real_memmove(dest, src, n);
+	}
+}
+
+// Allocation accounting
+void *operator new(size_t size) {
+	Benchmark::allocations++;
+	Benchmark::allocatedBytes += size;
+	void *ptr = malloc(size);
+	if(!ptr)
+		abort();
+	return ptr;
+}
+
+void *operator new[](size_t size) {
+	return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept {
+	free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+	free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+	free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+	free(ptr);
+}
@@ -0,0 +1,134 @@
+/**
+ * \ingroup host
+ * @file Benchmark.h
+ *
+ * Minimal microbenchmark harness for the host build
+ *
+ * Each benchmark operation is repeated until it runs for at least MIN_TIME_MS. Reported are time, heap allocations
+ * and bytes copied per operation. Allocations are counted by replaced global operator new. Copies are counted by
+ * wrapping memcpy and memmove at link time. The benchmark objects are compiled with -Os and library call string
+ * operations, so that structure copies of 64 bytes and more are done by memcpy and thus counted. Smaller copies
+ * are done inline and are not counted.
+ *
+ * \date 16. 10. 2026
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+/**
+ * Benchmark runner and counters
+ *
+ * \ingroup host
+ */
+class Benchmark {
+public:
+	/// Minimal time to repeat single benchmark for
+	static const long MIN_TIME_MS = 200;
+
+	/// Number of heap allocations
+	static size_t allocations;
+	/// Number of heap allocated bytes
+	static size_t allocatedBytes;
+	/// Number of bytes copied by memcpy and memmove
+	static size_t copiedBytes;
+
+	/**
+	 * Set benchmark name filter
+	 *
+	 * @param filter Only benchmarks containing this string in name are run, NULL to run all
+	 */
+	static void setFilter(const char *filter);
+
+	/**
+	 * Print result table header
+	 */
+	static void header();
+
+	/**
+	 * Run single benchmark
+	 *
+	 * @tparam OP Operation type, callable without arguments
+	 * @param name Benchmark name
+	 * @param op Operation to measure
+	 */
+	template<typename OP>
+	static void run(const char *name, OP op) {
+		if(!matches(name))
+			return;
+
+		// Warm up
+		op();
+
+		allocations = allocatedBytes = copiedBytes = 0;
+		size_t ops = 0;
+		size_t batch = 1;
+		const auto start = std::chrono::steady_clock::now();
+		std::chrono::steady_clock::duration elapsed;
+		do {
+			for(size_t i = 0; i < batch; ++i)
+				op();
+			ops += batch;
+			batch *= 2;
+			elapsed = std::chrono::steady_clock::now() - start;
+		} while(elapsed < std::chrono::milliseconds(MIN_TIME_MS));
+
+		report(name, ops, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+	}
+
+	/**
+	 * Run single benchmark timing only part of the operation
+	 *
+	 * Used when the operation needs setup that should not be measured.
+	 *
+	 * @tparam OP Operation type, callable without arguments returning the measured time as std::chrono::nanoseconds
+	 * @param name Benchmark name
+	 * @param op Operation to run
+	 */
+	template<typename OP>
+	static void runTimed(const char *name, OP op) {
+		if(!matches(name))
+			return;
+
+		// Warm up
+		op();
+
+		allocations = allocatedBytes = copiedBytes = 0;
+		size_t ops = 0;
+		std::chrono::nanoseconds measured(0);
+		const auto start = std::chrono::steady_clock::now();
+		do {
+			measured += op();
+			ops++;
+		} while(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(MIN_TIME_MS));
+
+		report(name, ops, measured.count());
+	}
+
+private:
+	/// Benchmark name filter
+	static const char *filter;
+
+	/**
+	 * Check benchmark name against filter
+	 *
+	 * @param name Benchmark name
+	 * @return Whenever the benchmark should be run
+	 */
+	static bool matches(const char *name);
+
+	/**
+	 * Print single benchmark result
+	 *
+	 * @param name Benchmark name
+	 * @param ops Number of executed operations
+	 * @param ns Total time in nanoseconds
+	 */
+	static void report(const char *name, size_t ops, long long ns);
+};
+
+#endif // BENCHMARK_H
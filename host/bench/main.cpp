@@ -0,0 +1,892 @@
+/**
+ * \ingroup host
+ * @file main.cpp
+ *
+ * Microbenchmarks of the CDEECO++ framework hot paths
+ *
+ * Measures fragment processing in System, fragment storing in KnowledgeCache, knowledge reads and writes in Component,
+ * task execution and knowledge exchange in Ensemble. The scheduler is never started, so benchmarks run on the main thread without
+ * interference from component, task and ensemble threads. Contended knowledge reads run against a writer thread
+ * started by the benchmark. Usage:
+ *
+ * $ build/bench/cdeeco++-bench [benchmark name filter]
+ *
+ * \date 16. 10. 2026
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#include "main.h"
+
+#include "cdeeco/System.h"
+#include "cdeeco/KnowledgeCache.h"
+#include "cdeeco/Component.h"
+#include "cdeeco/Ensemble.h"
+#include "cdeeco/Task.h"
+#include "cdeeco/TriggeredTask.h"
+
+#include "test/PortableSensor.h"
+#include "test/Alarm.h"
+
+#include "Benchmark.h"
+
+// Serial console, muted during benchmarks
+UART::Properties uart2Props { GPIOA, USART2 };
+UART uartSerial(uart2Props);
+Console console(uartSerial);
+
+/// PortableSensor knowledge magic
+const CDEECO::Type SENSOR_TYPE = 0x00000001;
+/// Alarm knowledge magic
+const CDEECO::Type ALARM_TYPE = 0x00000002;
+/// Blob knowledge magic
+const CDEECO::Type BLOB_TYPE = 0x00000003;
+
+/**
+ * Knowledge without fields, split into fragments of maximal size
+ */
+struct BenchBlob: CDEECO::Knowledge {
+	/// Opaque data
+	uint8_t data[200];
+};
+
+/**
+ * Radio dropping all broadcasted fragments
+ */
+class BenchRadio: public CDEECO::Radio {
+public:
+	/// Number of fragments broadcasted
+	size_t broadcasted = 0;
+	/// Whenever to report the fragments as dropped by full transmit queue
+	bool full = false;
+	/// Set when a fragment is being broadcasted, NULL to not signal
+	std::atomic<bool> *broadcasting = NULL;
+	/// Time spent waiting for space in transmit queue on each fragment, 0 to not wait
+	std::chrono::microseconds enqueueTime = std::chrono::microseconds(0);
+
+	bool broadcastFragment(const CDEECO::KnowledgeFragment &fragment) {
+		broadcasted++;
+		if(broadcasting != NULL)
+			*broadcasting = true;
+		if(enqueueTime.count() != 0)
+			std::this_thread::sleep_for(enqueueTime);
+		return !full;
+	}
+};
+
+/**
+ * Broadcaster recording versions of the broadcasted fragments
+ */
+class BenchRecorder: public CDEECO::Broadcaster {
+public:
+	/// Versions of the broadcasted fragments
+	CDEECO::Version versions[8];
+	/// Number of broadcasted fragments
+	size_t count = 0;
+
+	bool broadcastFragment(const CDEECO::KnowledgeFragment &fragment) {
+		if(count < 8)
+			versions[count] = fragment.version;
+		count++;
+		return true;
+	}
+};
+
+/**
+ * Component without tasks
+ *
+ * @tparam KNOWLEDGE Component's knowledge type
+ */
+template<typename KNOWLEDGE>
+class BenchComponent: public CDEECO::Component<KNOWLEDGE> {
+public:
+	/**
+	 * Benchmark component constructor
+	 *
+	 * @param broadcaster Broadcaster used by the component
+	 * @param id Component id
+	 * @param type Component type
+	 */
+	BenchComponent(CDEECO::Broadcaster &broadcaster, const CDEECO::Id id, const CDEECO::Type type) :
+			CDEECO::Component<KNOWLEDGE>(id, type, broadcaster) {
+		memset(&this->knowledge, 0, sizeof(KNOWLEDGE));
+	}
+};
+
+/**
+ * Triggered task counting its firings
+ */
+class BenchTrigger: public CDEECO::Triggerable {
+public:
+	/// Number of firings
+	size_t fired = 0;
+
+	void fire() {
+		fired++;
+	}
+};
+
+/**
+ * Alarm critical task, never executed as the scheduler is not started
+ */
+class BenchCriticalTask: public CDEECO::TriggeredTask<Alarm::Knowledge, bool, void, bool> {
+public:
+	/**
+	 * Task constructor
+	 *
+	 * @param component Alarm component
+	 */
+	BenchCriticalTask(CDEECO::Component<Alarm::Knowledge> &component) :
+			TriggeredTask(component.knowledge.tempCritical, component, &component.knowledge.tempCritical) {
+	}
+
+protected:
+	void run(const bool critical) {
+	}
+};
+
+/**
+ * Alarm check task receiving knowledge copy
+ *
+ * Uses the by-value run method and exposes the task execution.
+ */
+class BenchCopyTask: public CDEECO::Task<Alarm::Knowledge, bool> {
+public:
+	/**
+	 * Task constructor
+	 *
+	 * @param component Alarm component
+	 */
+	BenchCopyTask(CDEECO::Component<Alarm::Knowledge> &component) :
+			Task(component, component.knowledge.tempCritical) {
+	}
+
+	/** Execute the task once */
+	void step() {
+		execute();
+	}
+
+protected:
+	bool run(const Alarm::Knowledge in) {
+		return in.nearbySensors[0].value.temperature > 26.0f;
+	}
+};
+
+/**
+ * Alarm check task receiving knowledge snapshot
+ *
+ * Uses the by-reference runSnapshot method and exposes the task execution.
+ */
+class BenchSnapshotTask: public CDEECO::SnapshotTask<CDEECO::Task<Alarm::Knowledge, bool>, bool, Alarm::Knowledge> {
+public:
+	/**
+	 * Task constructor
+	 *
+	 * @param component Alarm component
+	 */
+	BenchSnapshotTask(CDEECO::Component<Alarm::Knowledge> &component) :
+			SnapshotTask(component, component.knowledge.tempCritical) {
+	}
+
+	/** Execute the task once */
+	void step() {
+		execute();
+	}
+
+protected:
+	bool runSnapshot(const Alarm::Knowledge &in) {
+		return in.nearbySensors[0].value.temperature > 26.0f;
+	}
+};
+
+/**
+ * Temperature exchange with deterministic mapping
+ *
+ * Mirrors the example TempExchange ensemble and exposes the exchange step.
+ */
+class BenchExchange: public CDEECO::Ensemble<Alarm::Knowledge, Alarm::Knowledge::SensorData, PortableSensor::Knowledge,
+		PortableSensor::Knowledge::CoordId> {
+public:
+	/**
+	 * Exchange constructor for node where coordinator is hosted
+	 *
+	 * @param coordinator Coordinator component
+	 * @param library Library of member component knowledge
+	 */
+	BenchExchange(CDEECO::Component<Alarm::Knowledge> &coordinator,
+			CDEECO::KnowledgeLibrary<PortableSensor::Knowledge> &library) :
+			Ensemble(&coordinator, &coordinator.knowledge.nearbySensors, &library, 1000) {
+	}
+
+	/** Run single knowledge exchange */
+	void exchange() {
+		runExchange();
+	}
+
+protected:
+	bool isMember(const CDEECO::Id coordId, const Alarm::Knowledge coordKnowledge, const CDEECO::Id memberId,
+			const PortableSensor::Knowledge memberKnowledge) {
+		return true;
+	}
+
+	Alarm::Knowledge::SensorData memberToCoordMap(const Alarm::Knowledge coord, const CDEECO::Id memberId,
+			const PortableSensor::Knowledge memberKnowledge) {
+		auto values = coord.nearbySensors;
+		auto &info = values[memberId % values.size()];
+		info.id = memberId;
+		info.value = memberKnowledge.value;
+		info.position = memberKnowledge.position;
+		return values;
+	}
+
+	PortableSensor::Knowledge::CoordId coordToMemberMap(const PortableSensor::Knowledge member,
+			const CDEECO::Id coordId, const Alarm::Knowledge coordKnowledge) {
+		return coordId;
+	}
+};
+
+/**
+ * Create fragment holding whole knowledge
+ *
+ * @param type Knowledge type
+ * @param id Component id
+ * @param knowledge Knowledge to store in the fragment
+ * @return Knowledge fragment
+ */
+template<typename KNOWLEDGE>
+CDEECO::KnowledgeFragment makeFragment(const CDEECO::Type type, const CDEECO::Id id, const KNOWLEDGE &knowledge) {
+	static_assert(sizeof(KNOWLEDGE) <= CDEECO::KnowledgeFragment::MAX_DATA_SIZE, "Knowledge does not fit fragment");
+
+	CDEECO::KnowledgeFragment fragment;
+	memset(&fragment, 0, sizeof(fragment));
+	fragment.type = type;
+	fragment.id = id;
+	fragment.offset = 0;
+	fragment.size = sizeof(KNOWLEDGE);
+	memcpy(fragment.data, &knowledge, sizeof(KNOWLEDGE));
+	return fragment;
+}
+
+/**
+ * Create sensor knowledge fragment
+ *
+ * @param id Sensor id
+ * @return Knowledge fragment with complete sensor knowledge
+ */
+CDEECO::KnowledgeFragment sensorFragment(const CDEECO::Id id) {
+	PortableSensor::Knowledge knowledge;
+	knowledge.position = { 50.0f + id * 0.001f, 14.0f };
+	knowledge.coordId = PortableSensor::Knowledge::NO_COORD;
+	knowledge.value = { 20.0f + id % 10, 50.0f };
+	return makeFragment(SENSOR_TYPE, id, knowledge);
+}
+
+/**
+ * Wait for the tick count to advance
+ *
+ * Cache records stored at tick 0 are indistinguishable from empty ones when looking for the oldest record.
+ */
+void waitTick() {
+	const TickType_t start = xTaskGetTickCount();
+	while(xTaskGetTickCount() == start)
+		usleep(100);
+}
+
+/**
+ * System fragment processing benchmarks
+ */
+void benchSystem() {
+	BenchRadio radio;
+	CDEECO::System<3, 64> system(radio);
+	CDEECO::KnowledgeCache<SENSOR_TYPE, PortableSensor::Knowledge, 10> sensorCache;
+	CDEECO::KnowledgeCache<ALARM_TYPE, Alarm::Knowledge, 10> alarmCache;
+	system.registerCache(&sensorCache);
+	system.registerCache(&alarmCache);
+
+	// Fragment data and version are changed for each operation, so they pass the duplicate filter and the cache
+	CDEECO::KnowledgeFragment fragment = sensorFragment(1);
+
+	Benchmark::run("System::receiveFragment strong signal", [&] {
+		fragment.data[0]++;
+		fragment.version++;
+		system.receiveFragment(fragment, 200);
+	});
+
+	Benchmark::run("System::receiveFragment weak signal (rebroadcast)", [&] {
+		fragment.data[0]++;
+		fragment.version++;
+		system.receiveFragment(fragment, 50);
+	});
+
+	Benchmark::run("System::receiveFragment duplicate", [&] {
+		system.receiveFragment(fragment, 50);
+	});
+}
+
+/**
+ * Knowledge fragment wire encoding benchmarks
+ */
+void benchFragment() {
+	CDEECO::KnowledgeFragment fragment = sensorFragment(1111);
+	CDEECO::KnowledgeFragment decoded;
+	uint8_t packet[CDEECO::KnowledgeFragment::MAX_PACKET_SIZE];
+	const size_t length = fragment.encode(packet);
+
+	Benchmark::run("KnowledgeFragment::encode sensor fragment", [&] {
+		uint8_t buffer[CDEECO::KnowledgeFragment::MAX_PACKET_SIZE];
+		fragment.encode(buffer);
+	});
+
+	Benchmark::run("KnowledgeFragment::decode sensor fragment", [&] {
+		if(decoded.decode(packet, length) != length)
+			abort();
+	});
+
+	// Delta of the sensor knowledge with changed temperature
+	CDEECO::KnowledgeFragment previous = sensorFragment(1111);
+	previous.data[offsetof(PortableSensor::Knowledge, value)]++;
+	CDEECO::KnowledgeFragment delta = fragment;
+
+	Benchmark::run("KnowledgeFragment::setDelta sensor value change", [&] {
+		delta.delta = false;
+		if(!delta.setDelta(fragment.data, previous.data, fragment.size))
+			abort();
+	});
+
+	Benchmark::run("KnowledgeFragment::applyDelta sensor value change", [&] {
+		delta.applyDelta(previous.data);
+	});
+}
+
+/**
+ * System cache dispatch benchmarks
+ *
+ * Eight caches are set up, the fragment matches the last one registered. Storing the fragment takes most of the time
+ * of the system cases, thus the registries are measured on their own with a fragment no cache accepts, which leaves
+ * only the lookup of the matching cache.
+ */
+void benchDispatch() {
+	BenchRadio radio;
+	CDEECO::KnowledgeFragment fragment = sensorFragment(1);
+
+	CDEECO::System<8, 8> system(radio);
+	CDEECO::KnowledgeCache<0x10, PortableSensor::Knowledge, 1> cache0;
+	CDEECO::KnowledgeCache<0x11, PortableSensor::Knowledge, 1> cache1;
+	CDEECO::KnowledgeCache<0x12, PortableSensor::Knowledge, 1> cache2;
+	CDEECO::KnowledgeCache<0x13, PortableSensor::Knowledge, 1> cache3;
+	CDEECO::KnowledgeCache<0x14, PortableSensor::Knowledge, 1> cache4;
+	CDEECO::KnowledgeCache<0x15, PortableSensor::Knowledge, 1> cache5;
+	CDEECO::KnowledgeCache<0x16, PortableSensor::Knowledge, 1> cache6;
+	CDEECO::KnowledgeCache<SENSOR_TYPE, PortableSensor::Knowledge, 1> sensorCache;
+	system.registerCache(&cache0);
+	system.registerCache(&cache1);
+	system.registerCache(&cache2);
+	system.registerCache(&cache3);
+	system.registerCache(&cache4);
+	system.registerCache(&cache5);
+	system.registerCache(&cache6);
+	system.registerCache(&sensorCache);
+
+	Benchmark::run("System::receiveFragment 8 registered caches", [&] {
+		fragment.data[0]++;
+		fragment.version++;
+		system.receiveFragment(fragment, 200);
+	});
+
+	CDEECO::TypedSystem<8, CDEECO::KnowledgeCache<0x10, PortableSensor::Knowledge, 1>,
+			CDEECO::KnowledgeCache<0x11, PortableSensor::Knowledge, 1>,
+			CDEECO::KnowledgeCache<0x12, PortableSensor::Knowledge, 1>,
+			CDEECO::KnowledgeCache<0x13, PortableSensor::Knowledge, 1>,
+			CDEECO::KnowledgeCache<0x14, PortableSensor::Knowledge, 1>,
+			CDEECO::KnowledgeCache<0x15, PortableSensor::Knowledge, 1>,
+			CDEECO::KnowledgeCache<0x16, PortableSensor::Knowledge, 1>,
+			CDEECO::KnowledgeCache<SENSOR_TYPE, PortableSensor::Knowledge, 1>> typedSystem(radio);
+
+	Benchmark::run("TypedSystem::receiveFragment 8 typed caches", [&] {
+		fragment.data[0]++;
+		fragment.version++;
+		typedSystem.receiveFragment(fragment, 200);
+	});
+
+	CDEECO::KnowledgeFragment unknown = sensorFragment(1);
+	unknown.type = 0x20;
+
+	CDEECO::CacheSlots<8> slots;
+	slots.registerCache(&cache0);
+	slots.registerCache(&cache1);
+	slots.registerCache(&cache2);
+	slots.registerCache(&cache3);
+	slots.registerCache(&cache4);
+	slots.registerCache(&cache5);
+	slots.registerCache(&cache6);
+	slots.registerCache(&sensorCache);
+
+	Benchmark::run("CacheSlots::storeFragment 8 caches, no match", [&] {
+		slots.storeFragment(unknown);
+	});
+
+	CDEECO::CacheRegistry<CDEECO::KnowledgeCache<0x10, PortableSensor::Knowledge, 1>,
+			CDEECO::KnowledgeCache<0x11, PortableSensor::Knowledge, 1>,
+			CDEECO::KnowledgeCache<0x12, PortableSensor::Knowledge, 1>,
+			CDEECO::KnowledgeCache<0x13, PortableSensor::Knowledge, 1>,
+			CDEECO::KnowledgeCache<0x14, PortableSensor::Knowledge, 1>,
+			CDEECO::KnowledgeCache<0x15, PortableSensor::Knowledge, 1>,
+			CDEECO::KnowledgeCache<0x16, PortableSensor::Knowledge, 1>,
+			CDEECO::KnowledgeCache<SENSOR_TYPE, PortableSensor::Knowledge, 1>> registry;
+
+	Benchmark::run("CacheRegistry::storeFragment 8 caches, no match", [&] {
+		registry.storeFragment(unknown);
+	});
+}
+
+/**
+ * Knowledge cache benchmarks
+ *
+ * @tparam SIZE Size of the cache
+ */
+template<size_t SIZE>
+void benchCache() {
+	auto cache = new CDEECO::KnowledgeCache<SENSOR_TYPE, PortableSensor::Knowledge, SIZE>();
+	char name[64];
+
+	waitTick();
+	for(CDEECO::Id id = 1; id <= SIZE; ++id)
+		cache->storeFragment(sensorFragment(id));
+
+	// Last record is the worst case for lookup
+	CDEECO::KnowledgeFragment hit = sensorFragment(SIZE);
+	snprintf(name, sizeof(name), "KnowledgeCache::storeFragment hit, %u records", (unsigned) SIZE);
+	Benchmark::run(name, [&] {
+		hit.version++;
+		cache->storeFragment(hit);
+	});
+
+	snprintf(name, sizeof(name), "KnowledgeCache::storeFragment hit same version, %u records", (unsigned) SIZE);
+	Benchmark::run(name, [&] {
+		cache->storeFragment(hit);
+	});
+
+	CDEECO::Id next = SIZE + 1;
+	snprintf(name, sizeof(name), "KnowledgeCache::storeFragment miss, %u records", (unsigned) SIZE);
+	Benchmark::run(name, [&] {
+		CDEECO::KnowledgeFragment miss = hit;
+		miss.id = next++;
+		cache->storeFragment(miss);
+	});
+
+	delete cache;
+}
+
+/**
+ * Knowledge cache fragment range versions benchmark
+ *
+ * Each operation stores a newer version of the first fragment range followed by an older version of the second one.
+ * The ranges keep their own versions, thus the older fragment of the other range has to be stored.
+ */
+void benchCacheRanges() {
+	CDEECO::KnowledgeCache<BLOB_TYPE, BenchBlob, 10> cache;
+	typedef CDEECO::FragmentPlan<BenchBlob> Plan;
+
+	CDEECO::KnowledgeFragment first;
+	memset(&first, 0, sizeof(first));
+	first.type = BLOB_TYPE;
+	first.id = 1;
+	CDEECO::KnowledgeFragment second = first;
+	first.offset = Plan::getFragment(0).start;
+	first.size = Plan::getFragment(0).size;
+	second.offset = Plan::getFragment(1).start;
+	second.size = Plan::getFragment(1).size;
+
+	waitTick();
+	CDEECO::Version version = 1;
+	Benchmark::run("KnowledgeCache::storeFragment older version of other range", [&] {
+		first.version = version + 1;
+		second.version = version;
+		second.data[0] = (char) version;
+		cache.storeFragment(first);
+		cache.storeFragment(second);
+
+		const auto record = *cache.begin();
+		if(!record.complete || ((const uint8_t*) &record.knowledge)[second.offset] != (uint8_t) version)
+			abort();
+		version += 2;
+	});
+}
+
+/**
+ * Rebroadcast storage delta chain benchmark
+ *
+ * Each operation receives two consecutive delta fragments of the same range and flushes the storage. Relaying nodes
+ * need both deltas, thus both have to be rebroadcasted in the order of versions. Fragments are offered repeatedly as
+ * the storage drops them randomly.
+ */
+void benchRebroadcast() {
+	BenchRecorder recorder;
+	CDEECO::RebroadcastStorage<4> storage(recorder);
+
+	CDEECO::KnowledgeFragment delta = sensorFragment(1);
+	delta.delta = true;
+	CDEECO::Version version = 1;
+	Benchmark::run("RebroadcastStorage::storeFragment delta after delta", [&] {
+		recorder.count = 0;
+		for(CDEECO::Version next = version; next != version + 2; ++next) {
+			delta.version = next;
+			for(size_t i = 0; i < 64; ++i)
+				storage.storeFragment(delta, 0);
+		}
+		storage.flush();
+
+		if(recorder.count != 2 || recorder.versions[0] != version || recorder.versions[1] != version + 1)
+			abort();
+		version += 2;
+	});
+}
+
+/**
+ * Component knowledge write benchmarks
+ */
+void benchComponent() {
+	BenchRadio radio;
+	CDEECO::System<1, 8> system(radio);
+	BenchComponent<PortableSensor::Knowledge> sensor(system, 1, SENSOR_TYPE);
+	BenchComponent<Alarm::Knowledge> alarm(system, 2, ALARM_TYPE);
+
+	PortableSensor::Knowledge::Value value = { 20.0f, 50.0f };
+	Benchmark::run("Component::lockWriteKnowledge small (sensor value)", [&] {
+		value.temperature += 1.0f;
+		sensor.lockWriteKnowledge(sensor.knowledge.value, value);
+	});
+
+	Benchmark::run("Component::lockWriteKnowledge unchanged", [&] {
+		sensor.lockWriteKnowledge(sensor.knowledge.value, value);
+	});
+
+	Alarm::Knowledge::SensorData sensors;
+	memset(&sensors, 0, sizeof(sensors));
+	Benchmark::run("Component::lockWriteKnowledge large (alarm sensors)", [&] {
+		sensors[0].value.temperature += 1.0f;
+		alarm.lockWriteKnowledge(alarm.knowledge.nearbySensors, sensors);
+	});
+
+	// Each trigger watches value of one sensor, only the first one changes
+	BenchTrigger triggers[8];
+	for(size_t i = 0; i < 8; ++i)
+		alarm.addTriggeredTask(triggers[i], alarm.knowledge.nearbySensors[i].value);
+	PortableSensor::Knowledge::Value sensorValue = { 20.0f, 50.0f };
+	Benchmark::run("Component::lockWriteKnowledge sensor value, 8 triggered tasks", [&] {
+		sensorValue.temperature += 1.0f;
+		alarm.lockWriteKnowledge(alarm.knowledge.nearbySensors[0].value, sensorValue);
+		if(triggers[0].fired == 0 || triggers[1].fired != 0)
+			abort();
+	});
+
+	// Fragment boundary inside a dirty block, the block has to be cleared when both fragments are broadcasted
+	BenchComponent<BenchBlob> blob(system, 3, BLOB_TYPE);
+	const size_t boundary = CDEECO::FragmentPlan<BenchBlob>::getFragment(1).start;
+	Benchmark::run("Component::lockWriteKnowledge unaligned fragment boundary", [&] {
+		if(boundary % 8 == 0)
+			abort();
+
+		const uint8_t shared = blob.knowledge.data[boundary] + 1;
+		size_t broadcasted = radio.broadcasted;
+		blob.lockWriteKnowledge(blob.knowledge.data[boundary], shared);
+		if(radio.broadcasted != broadcasted + 2)
+			abort();
+
+		const uint8_t last = blob.knowledge.data[sizeof(blob.knowledge.data) - 1] + 1;
+		broadcasted = radio.broadcasted;
+		blob.lockWriteKnowledge(blob.knowledge.data[sizeof(blob.knowledge.data) - 1], last);
+		if(radio.broadcasted != broadcasted + 1)
+			abort();
+	});
+
+	// Fragment dropped by full transmit queue, its range has to be broadcasted with the next change
+	Benchmark::run("Component::lockWriteKnowledge dropped fragment", [&] {
+		radio.full = true;
+		const uint8_t last = blob.knowledge.data[sizeof(blob.knowledge.data) - 1] + 1;
+		size_t broadcasted = radio.broadcasted;
+		blob.lockWriteKnowledge(blob.knowledge.data[sizeof(blob.knowledge.data) - 1], last);
+		radio.full = false;
+		if(radio.broadcasted != broadcasted + 1)
+			abort();
+
+		const uint8_t first = blob.knowledge.data[0] + 1;
+		broadcasted = radio.broadcasted;
+		blob.lockWriteKnowledge(blob.knowledge.data[0], first);
+		if(radio.broadcasted != broadcasted + 2)
+			abort();
+	});
+
+	// Knowledge without described fields, only the task watching the changed byte fires
+	BenchTrigger blobTriggers[2];
+	blob.addTriggeredTask(blobTriggers[0], blob.knowledge.data[10]);
+	blob.addTriggeredTask(blobTriggers[1], blob.knowledge.data[12]);
+	Benchmark::run("Component::lockWriteKnowledge undescribed, 2 triggered tasks", [&] {
+		BenchBlob next = blob.knowledge;
+		next.data[10]++;
+		const size_t fired = blobTriggers[0].fired;
+		blob.lockWriteKnowledge(blob.knowledge, next);
+		if(blobTriggers[0].fired != fired + 1 || blobTriggers[1].fired != 0)
+			abort();
+	});
+
+	Benchmark::run("Component::lockReadKnowledge projected (alarm position)", [&] {
+		const Alarm::Knowledge::Position in = alarm.lockReadKnowledge(alarm.knowledge.position);
+		if(in.lat != 0.0f)
+			abort();
+	});
+}
+
+/**
+ * Component knowledge read benchmarks
+ *
+ * Reads are measured with and without a writer thread continuously updating the knowledge.
+ *
+ * @param lockFree Whenever to use lock-free knowledge reads
+ * @param name Benchmark name without contention
+ * @param contendedName Benchmark name under contention
+ */
+void benchRead(const bool lockFree, const char *name, const char *contendedName) {
+	BenchRadio radio;
+	CDEECO::System<1, 8> system(radio);
+	BenchComponent<Alarm::Knowledge> alarm(system, 2, ALARM_TYPE);
+	alarm.setLockFreeReads(lockFree);
+
+	Benchmark::run(name, [&] {
+		const Alarm::Knowledge in = alarm.lockReadKnowledge();
+		if(in.tempCritical)
+			abort();
+	});
+
+	// Writer changing the sensor data and broadcasting the change
+	std::atomic<bool> stop(false);
+	std::thread writer([&] {
+		Alarm::Knowledge::SensorData sensors;
+		memset(&sensors, 0, sizeof(sensors));
+		while(!stop) {
+			sensors[0].value.temperature += 1.0f;
+			alarm.lockWriteKnowledge(alarm.knowledge.nearbySensors, sensors);
+		}
+	});
+
+	Benchmark::run(contendedName, [&] {
+		const Alarm::Knowledge in = alarm.lockReadKnowledge();
+		if(in.tempCritical)
+			abort();
+	});
+
+	stop = true;
+	writer.join();
+}
+
+/**
+ * Component knowledge read during broadcast benchmark
+ *
+ * Each operation lets a writer thread change the knowledge and reads the knowledge once the change is being
+ * broadcasted. Only the read is timed. The broadcast goes through a radio waiting 50us for space in the transmit queue
+ * on each fragment and is looped back into a cache by the system. The read waits for the broadcast when it is done under
+ * the knowledge lock.
+ */
+void benchBroadcastRead() {
+	std::atomic<bool> broadcasting(false);
+	BenchRadio radio;
+	radio.broadcasting = &broadcasting;
+	radio.enqueueTime = std::chrono::microseconds(50);
+	CDEECO::System<1, 8> system(radio);
+	CDEECO::KnowledgeCache<ALARM_TYPE, Alarm::Knowledge, 10> alarmCache;
+	system.registerCache(&alarmCache);
+	BenchComponent<Alarm::Knowledge> alarm(system, 2, ALARM_TYPE);
+
+	// Writer changing the sensor data on request
+	std::atomic<bool> stop(false);
+	std::atomic<bool> write(false);
+	std::thread writer([&] {
+		Alarm::Knowledge::SensorData sensors;
+		memset(&sensors, 0, sizeof(sensors));
+		while(!stop) {
+			if(!write) {
+				std::this_thread::yield();
+				continue;
+			}
+			sensors[0].value.temperature += 1.0f;
+			alarm.lockWriteKnowledge(alarm.knowledge.nearbySensors, sensors);
+			write = false;
+		}
+	});
+
+	Benchmark::runTimed("Component::lockReadKnowledge during broadcast", [&] {
+		broadcasting = false;
+		write = true;
+		while(!broadcasting)
+			std::this_thread::yield();
+
+		const auto start = std::chrono::steady_clock::now();
+		const Alarm::Knowledge in = alarm.lockReadKnowledge();
+		const auto elapsed = std::chrono::steady_clock::now() - start;
+		if(in.tempCritical)
+			abort();
+
+		// Let the write finish before the next operation
+		while(write)
+			std::this_thread::yield();
+
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed);
+	});
+
+	stop = true;
+	writer.join();
+}
+
+/**
+ * Concurrent knowledge write benchmark
+ *
+ * A writer thread keeps changing the second sensor while the benchmark changes the first one. Broadcasts go through a
+ * radio waiting 50us for space in the transmit queue on each fragment and are looped back into a cache by the system.
+ * Once a write returns its change has to be in the cache, broadcasted either by the write itself or by the other writer.
+ */
+void benchWriters() {
+	BenchRadio radio;
+	radio.enqueueTime = std::chrono::microseconds(50);
+	CDEECO::System<1, 8> system(radio);
+	CDEECO::KnowledgeCache<ALARM_TYPE, Alarm::Knowledge, 10> alarmCache;
+	system.registerCache(&alarmCache);
+	BenchComponent<Alarm::Knowledge> alarm(system, 2, ALARM_TYPE);
+
+	// Change all the knowledge bytes, thus the cached record is complete
+	Alarm::Knowledge initial;
+	memset(&initial, 0xff, sizeof(initial));
+	alarm.lockWriteKnowledge(alarm.knowledge, initial);
+
+	// Writer changing the second sensor value
+	std::atomic<bool> stop(false);
+	std::thread writer([&] {
+		PortableSensor::Knowledge::Value value = { 20.0f, 50.0f };
+		while(!stop) {
+			value.temperature += 1.0f;
+			alarm.lockWriteKnowledge(alarm.knowledge.nearbySensors[1].value, value);
+		}
+	});
+
+	PortableSensor::Knowledge::Value value = { 20.0f, 50.0f };
+	Benchmark::run("Component::lockWriteKnowledge two writers", [&] {
+		value.temperature += 1.0f;
+		alarm.lockWriteKnowledge(alarm.knowledge.nearbySensors[0].value, value);
+
+		bool found = false;
+		for(auto it = alarmCache.begin(); it != alarmCache.end(); ++it) {
+			CDEECO::Id id;
+			Alarm::Knowledge in;
+			if(it.readComplete(id, in) && id == 2)
+				found = in.nearbySensors[0].value.temperature == value.temperature;
+		}
+		if(!found)
+			abort();
+	});
+
+	stop = true;
+	writer.join();
+}
+
+/**
+ * Task execution benchmarks
+ */
+void benchTask() {
+	BenchRadio radio;
+	CDEECO::System<1, 8> system(radio);
+	BenchComponent<Alarm::Knowledge> alarm(system, 2, ALARM_TYPE);
+
+	BenchCopyTask copyTask(alarm);
+	Benchmark::run("Task::execute alarm check, knowledge copy", [&] {
+		copyTask.step();
+	});
+
+	BenchSnapshotTask snapshotTask(alarm);
+	Benchmark::run("Task::execute alarm check, knowledge snapshot", [&] {
+		snapshotTask.step();
+	});
+
+	// Task does not run, thus all triggers after the first one are coalesced
+	BenchCriticalTask criticalTask(alarm);
+	bool critical = true;
+	alarm.lockWriteKnowledge(alarm.knowledge.tempCritical, critical);
+	Benchmark::run("TriggeredTask trigger burst, execution pending", [&] {
+		const uint32_t coalesced = criticalTask.getCoalescedTriggers();
+		critical = !critical;
+		alarm.lockWriteKnowledge(alarm.knowledge.tempCritical, critical);
+		if(criticalTask.getCoalescedTriggers() != coalesced + 1)
+			abort();
+	});
+}
+
+/**
+ * Ensemble exchange benchmarks
+ *
+ * @tparam SIZE Number of records in the member library
+ * @param name Benchmark name
+ */
+template<size_t SIZE>
+void benchEnsemble(const char *name) {
+	BenchRadio radio;
+	CDEECO::System<1, 8> system(radio);
+	BenchComponent<Alarm::Knowledge> alarm(system, 2, ALARM_TYPE);
+	for(auto &info : alarm.knowledge.nearbySensors)
+		info.id = Alarm::Knowledge::NO_MEMBER;
+
+	auto cache = new CDEECO::KnowledgeCache<SENSOR_TYPE, PortableSensor::Knowledge, SIZE>();
+	waitTick();
+	for(CDEECO::Id id = 1; id <= SIZE; ++id)
+		cache->storeFragment(sensorFragment(id));
+
+	BenchExchange exchange(alarm, *cache);
+	Benchmark::run(name, [&] {
+		exchange.exchange();
+	});
+
+	delete cache;
+}
+
+/** Benchmark entry point */
+int main(int argc, char **argv) {
+	uartSerial.init();
+	console.init();
+	console.setLevel(None);
+
+	Benchmark::setFilter(argc > 1 ? argv[1] : NULL);
+	Benchmark::header();
+
+	benchSystem();
+	benchFragment();
+	benchDispatch();
+
+	benchCache<10>();
+	benchCache<100>();
+	benchCache<1000>();
+	benchCacheRanges();
+	benchRebroadcast();
+
+	benchComponent();
+	benchRead(false, "Component::lockReadKnowledge mutex", "Component::lockReadKnowledge mutex, contended");
+	benchRead(true, "Component::lockReadKnowledge lock-free", "Component::lockReadKnowledge lock-free, contended");
+	benchBroadcastRead();
+	benchWriters();
+	benchTask();
+
+	benchEnsemble<10>("Ensemble::runExchange member->coord, 10 records");
+	benchEnsemble<100>("Ensemble::runExchange member->coord, 100 records");
+	benchEnsemble<1000>("Ensemble::runExchange member->coord, 1000 records");
+
+	fflush(stdout);
+
+	// Tasks created by the framework were never started, do not run static destructors under them
+	_exit(0);
+}
@@ -0,0 +1,48 @@
+/**
+ * \ingroup host
+ * @file GPS.cpp
+ *
+ * Host GPS driver stub
+ *
+ * Always reports the same valid fix.
+ *
+ * \date 16. 10. 2026
+ */
+
+#include "GPS.h"
+
+GPSL10::GPSL10(UART& uart) :
+		uart(uart) {
+}
+
+GPSL10::~GPSL10() {
+}
+
+void GPSL10::init() {
+}
+
+void GPSL10::setSentenceListener(SentenceListener sentenceListener, void* obj) {
+	this->sentenceListener = sentenceListener;
+	sentenceListenerObj = obj;
+}
+
+GPSL10::GPSFix GPSL10::getGPSFix() {
+	GPSFix res = { };
+	res.valid = true;
+	res.day = 16;
+	res.month = 10;
+	res.year = 2026;
+	res.latitude = 50.125522f;
+	res.longitude = 14.529707f;
+	return res;
+}
+
+GPSL30::GPSL30(Properties& initProps, UART& uart) :
+		GPSL10(uart), props(initProps) {
+}
+
+GPSL30::~GPSL30() {
+}
+
+void GPSL30::init() {
+}
@@ -0,0 +1,51 @@
+/**
+ * \ingroup host
+ * @file LED.cpp
+ *
+ * Host LED driver stub
+ *
+ * \date 16. 10. 2026
+ */
+
+#include "LED.h"
+
+LED::LED(Properties& initProps) :
+		props(initProps) {
+}
+
+LED::~LED() {
+}
+
+void LED::init() {
+}
+
+void LED::on() {
+}
+
+void LED::off() {
+}
+
+PulseLED* PulseLED::tickListeners[MAX_TICK_LISTENERS];
+int PulseLED::tickListenersNum = 0;
+
+void PulseLED::tickInterruptHandler() {
+}
+
+PulseLED::PulseLED(LED& led, int minimalOnTimeTicks) :
+		led(led), minimalOnTimeTicks(minimalOnTimeTicks), onTicks(-1) {
+}
+
+PulseLED::~PulseLED() {
+}
+
+void PulseLED::init() {
+}
+
+void PulseLED::pulse() {
+}
+
+void PulseLED::tick() {
+}
+
+void PulseLED::initTimer(Properties &props) {
+}
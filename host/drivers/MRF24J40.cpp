@@ -0,0 +1,203 @@
+/**
+ * \ingroup host
+ * @file MRF24J40.cpp
+ *
+ * Host MRF24J40 driver stub
+ *
+ * The radio is emulated by UDP multicast on the loopback interface. All host nodes running on the same machine
+ * share one emulated channel. Each datagram carries channel, PAN id and source address followed by the frame
+ * payload. The real radio is set to promiscuous mode, so only frames sent by this node and frames from other
+ * channels are ignored. When the socket cannot be set up the radio silently drops all transmitted packets.
+ *
+ * \date 16. 10. 2026
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <thread>
+
+#include "MRF24J40.h"
+
+namespace {
+	/// Emulated ether multicast group
+	const char * const ETHER_GROUP = "239.205.238.192";
+	/// Emulated ether port
+	const uint16_t ETHER_PORT = 52716;
+	/// Emulated frame header size (channel, PAN id, source address)
+	const size_t ETHER_HEADER = 5;
+	/// Link quality reported for all received packets
+	const uint8_t ETHER_LQI = 100;
+
+	/// Socket used for the emulated ether, -1 when unavailable
+	int etherSocket = -1;
+	/// Last received datagram
+	uint8_t etherFrame[ETHER_HEADER + CDEECO::KnowledgeFragment::MAX_PACKET_SIZE];
+	/// Last received datagram size
+	size_t etherFrameSize = 0;
+
+	/**
+	 * Open emulated ether socket
+	 *
+	 * @return Socket descriptor or -1 on failure
+	 */
+	int openEther() {
+		int sock = socket(AF_INET, SOCK_DGRAM, 0);
+		if(sock < 0)
+			return -1;
+
+		int one = 1;
+		setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+		setsockopt(sock, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one));
+
+		sockaddr_in addr = { };
+		addr.sin_family = AF_INET;
+		addr.sin_port = htons(ETHER_PORT);
+		addr.sin_addr.s_addr = htonl(INADDR_ANY);
+
+		ip_mreq group = { };
+		group.imr_multiaddr.s_addr = inet_addr(ETHER_GROUP);
+		group.imr_interface.s_addr = htonl(INADDR_LOOPBACK);
+
+		in_addr loopback = { };
+		loopback.s_addr = htonl(INADDR_LOOPBACK);
+
+		if(bind(sock, (sockaddr*) &addr, sizeof(addr)) < 0
+				|| setsockopt(sock, IPPROTO_IP, IP_ADD_MEMBERSHIP, &group, sizeof(group)) < 0
+				|| setsockopt(sock, IPPROTO_IP, IP_MULTICAST_IF, &loopback, sizeof(loopback)) < 0) {
+			close(sock);
+			return -1;
+		}
+
+		return sock;
+	}
+}
+
+MRF24J40::MRF24J40(Properties& initProps, PulseLED& recvLed, PulseLED& sendLed) :
+		props(initProps), recvLed(recvLed), sendLed(sendLed) {
+}
+
+MRF24J40::~MRF24J40() {
+}
+
+void MRF24J40::setRFPriority(uint8_t irqPreemptionPriority, uint8_t irqSubPriority) {
+	irqRFPreemptionPriority = irqPreemptionPriority;
+	irqRFSubPriority = irqSubPriority;
+}
+
+void MRF24J40::setSPIPriority(uint8_t irqPreemptionPriority, uint8_t irqSubPriority) {
+	irqSPIPreemptionPriority = irqPreemptionPriority;
+	irqSPISubPriority = irqSubPriority;
+}
+
+void MRF24J40::init() {
+	etherSocket = openEther();
+	if(etherSocket < 0)
+		return;
+
+	// Receive thread plays the role of the RF interrupt
+	std::thread([this] {
+		while(true) {
+			ssize_t size = recv(etherSocket, etherFrame, sizeof(etherFrame), 0);
+			if(size < 0)
+				return;
+			etherFrameSize = size;
+			rfInterruptHandler();
+		}
+	}).detach();
+}
+
+void MRF24J40::rfInterruptHandler() {
+	if(etherFrameSize <= ETHER_HEADER)
+		return;
+
+	// Drop own packets and packets from other channels
+	if(etherFrame[0] != channel || (etherFrame[3] == sAddr[0] && etherFrame[4] == sAddr[1]))
+		return;
+
+	if(recvListener)
+		recvListener(recvListenerObj);
+}
+
+void MRF24J40::setRecvListener(RecvListener recvListener, void* obj) {
+	this->recvListener = recvListener;
+	this->recvListenerObj = obj;
+}
+
+void MRF24J40::setBroadcastCompleteListener(BroadcastCompleteListener broadcastCompleteListener, void* obj) {
+	this->broadcastCompleteListener = broadcastCompleteListener;
+	this->broadcastCompleteListenerObj = obj;
+}
+
+void MRF24J40::reset() {
+}
+
+void MRF24J40::setChannel(uint8_t channel) {
+	this->channel = channel;
+}
+
+uint8_t MRF24J40::readChannel() {
+	return channel;
+}
+
+void MRF24J40::setPANId(uint8_t panId[2]) {
+	this->panId[0] = panId[0];
+	this->panId[1] = panId[1];
+}
+
+uint16_t MRF24J40::readPANId() {
+	return getPANId();
+}
+
+void MRF24J40::setSAddr(uint8_t sAddr[2]) {
+	this->sAddr[0] = sAddr[0];
+	this->sAddr[1] = sAddr[1];
+}
+
+uint16_t MRF24J40::readSAddr() {
+	return getSAddr();
+}
+
+void MRF24J40::broadcastPacket(uint8_t* data, uint8_t dataLength) {
+	if(etherSocket >= 0) {
+		uint8_t frame[ETHER_HEADER + CDEECO::KnowledgeFragment::MAX_PACKET_SIZE];
+		frame[0] = channel;
+		frame[1] = panId[0];
+		frame[2] = panId[1];
+		frame[3] = sAddr[0];
+		frame[4] = sAddr[1];
+		memcpy(frame + ETHER_HEADER, data, dataLength);
+
+		sockaddr_in addr = { };
+		addr.sin_family = AF_INET;
+		addr.sin_port = htons(ETHER_PORT);
+		addr.sin_addr.s_addr = inet_addr(ETHER_GROUP);
+		sendto(etherSocket, frame, ETHER_HEADER + dataLength, 0, (sockaddr*) &addr, sizeof(addr));
+	}
+
+	txCount++;
+
+	if(broadcastCompleteListener)
+		broadcastCompleteListener(broadcastCompleteListenerObj, true);
+}
+
+bool MRF24J40::recvPacket(uint8_t (&data)[CDEECO::KnowledgeFragment::MAX_PACKET_SIZE], uint8_t& dataLength,
+		uint8_t (&srcPanId)[2], uint8_t (&srcSAddr)[2], uint8_t (&fcs)[2], uint8_t& lqi, uint8_t& rssi) {
+	dataLength = etherFrameSize - ETHER_HEADER;
+	memcpy(data, etherFrame + ETHER_HEADER, dataLength);
+
+	srcPanId[0] = etherFrame[1];
+	srcPanId[1] = etherFrame[2];
+	srcSAddr[0] = etherFrame[3];
+	srcSAddr[1] = etherFrame[4];
+	fcs[0] = fcs[1] = 0;
+	lqi = ETHER_LQI;
+	rssi = 0;
+
+	rxCount++;
+
+	return true;
+}
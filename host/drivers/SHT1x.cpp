@@ -0,0 +1,30 @@
+/**
+ * \ingroup host
+ * @file SHT1x.cpp
+ *
+ * Host SHT1x driver stub
+ *
+ * Reports slowly drifting synthetic values.
+ *
+ * \date 16. 10. 2026
+ */
+
+#include "SHT1x.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+SHT1x::SHT1x(Properties &properties) :
+		properties(properties) {
+}
+
+void SHT1x::init() {
+}
+
+float SHT1x::readTemperature() {
+	return 22.0f + (xTaskGetTickCount() / 1000 % 60) * 0.1f;
+}
+
+float SHT1x::readHumidity() {
+	return 40.0f + (xTaskGetTickCount() / 1000 % 30) * 0.5f;
+}
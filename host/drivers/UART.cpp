@@ -0,0 +1,63 @@
+/**
+ * \ingroup host
+ * @file UART.cpp
+ *
+ * Host UART driver stub
+ *
+ * The UART inline methods access the emulated USART registers. Transmitted data end up on the standard output,
+ * receive is never signaled.
+ *
+ * \date 16. 10. 2026
+ */
+
+#include "UART.h"
+
+UART::UART(Properties& initProps) :
+		irqPreemptionPriority(0), irqSubPriority(0), rxIntEnabled(false), txIntEnabled(false), sendListener(NULL), sendListenerObj(
+				NULL), recvListener(NULL), recvListenerObj(NULL), props(initProps) {
+}
+
+UART::~UART() {
+}
+
+void UART::setPriority(uint8_t irqPreemptionPriority, uint8_t irqSubPriority) {
+	this->irqPreemptionPriority = irqPreemptionPriority;
+	this->irqSubPriority = irqSubPriority;
+}
+
+void UART::init() {
+	// Transmitter is always ready
+	props.usart->SR = USART_FLAG_TXE | USART_FLAG_TC;
+}
+
+void UART::clearBreakOrError() {
+}
+
+void UART::enableSendEvents() {
+	txIntEnabled = true;
+}
+
+void UART::disableSendEvents() {
+	txIntEnabled = false;
+}
+
+void UART::setSendListener(Listener sendReadyListener, void *obj) {
+	this->sendListener = sendReadyListener;
+	sendListenerObj = obj;
+}
+
+void UART::enableRecvEvents() {
+	rxIntEnabled = true;
+}
+
+void UART::disableRecvEvents() {
+	rxIntEnabled = false;
+}
+
+void UART::setRecvListener(Listener recvReadyListener, void *obj) {
+	this->recvListener = recvReadyListener;
+	recvListenerObj = obj;
+}
+
+void UART::txrxInterruptHandler() {
+}
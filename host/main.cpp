@@ -0,0 +1,164 @@
+/**
+ * \ingroup host
+ * @file main.cpp
+ *
+ * Host application entry point and CDEECO++ system initialization
+ *
+ * Runs the example application on Linux with stubbed drivers. Usage:
+ *
+ * $ build/host/cdeeco++ [unique id in hex] [run time in seconds] [number of executor workers]
+ *
+ * Without the unique id the process id is used. Without the run time the application runs until killed. With the
+ * number of workers the tasks, ensembles and components run as jobs of the shared executor.
+ *
+ * \date 16. 10. 2026
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "main.h"
+
+#include "cdeeco/System.h"
+#include "cdeeco/KnowledgeCache.h"
+#include "cdeeco/Executor.h"
+#include "cdeeco/StackMonitor.h"
+#include "cdeeco/PriorityAssignment.h"
+
+#include "test/MrfRadio.h"
+#include "test/TestComponent.h"
+#include "test/PortableSensor.h"
+#include "test/Alarm.h"
+#include "test/TempExchange.h"
+
+// GPS
+UART::Properties uart6Props { GPIOC, USART6 };
+UART uartGPS(uart6Props);
+GPSL30::Properties gpsProps { };
+GPSL30 gps(gpsProps, uartGPS);
+
+// LEDs
+LED::Properties greenLedProperties { GPIOD, GPIO_Pin_12, RCC_AHB1Periph_GPIOD };
+LED greenLED(greenLedProperties);
+LED::Properties orangeLEDProperties { GPIOD, GPIO_Pin_13, RCC_AHB1Periph_GPIOD };
+LED orangeLED(orangeLEDProperties);
+LED::Properties redLEDProperties { GPIOD, GPIO_Pin_14, RCC_AHB1Periph_GPIOD };
+LED redLED(redLEDProperties);
+LED::Properties blueLEDProperties { GPIOD, GPIO_Pin_15, RCC_AHB1Periph_GPIOD };
+LED blueLED(blueLEDProperties);
+
+// Pulse LEDs
+PulseLED greenPulseLED = PulseLED(greenLED, 1);
+PulseLED redPulseLED = PulseLED(redLED, 1);
+
+// ZigBee
+MRF24J40::Properties mrfProps { };
+MRF24J40 mrf = MRF24J40(mrfProps, greenPulseLED, redPulseLED);
+
+// Serial console
+UART::Properties uart2Props { GPIOA, USART2 };
+UART uartSerial(uart2Props);
+Console console(uartSerial);
+
+/**
+ * Stops the scheduler after given time
+ */
+class Shutdown: FreeRTOSTask {
+public:
+	/**
+	 * Shutdown task constructor
+	 *
+	 * @param seconds Time to run the scheduler for
+	 */
+	Shutdown(const uint32_t seconds) :
+			FreeRTOSTask(DEFAULT_STACK_SIZE, DEFAULT_PRIORITY, "Shutdown"), seconds(seconds) {
+	}
+
+private:
+	/// Time to run the scheduler for
+	const uint32_t seconds;
+
+	void run() {
+		vTaskDelay(seconds * 1000 / portTICK_PERIOD_MS);
+		vTaskEndScheduler();
+	}
+};
+
+void cdeecoSetup(const uint32_t uniqId) {
+	//// System setup
+	auto radio = new MrfRadio(0, uniqId, uniqId);
+	auto system = new CDEECO::TypedSystem<64,
+			CDEECO::KnowledgeCache<PortableSensor::Component::Type, PortableSensor::Knowledge, 10>,
+			CDEECO::KnowledgeCache<Alarm::Component::Type, Alarm::Knowledge, 10>>(*radio);
+
+	// Test component
+	new TestComponent::Component(*system, uniqId);
+
+	///// Temperature monitoring system
+	// Components
+	auto sensor = new PortableSensor::Component(*system, uniqId);
+	auto alarm = new Alarm::Component(*system, uniqId);
+
+	// Caches
+	auto &sensorCache = system->getCache<PortableSensor::Component::Type>();
+	auto &alarmCache = system->getCache<Alarm::Component::Type>();
+
+	// Ensembles
+	new TempExchange::Ensemble(*alarm, sensorCache);
+	new TempExchange::Ensemble(*sensor, alarmCache);
+}
+
+/** Host system startup function */
+int main(int argc, char **argv) {
+	uartGPS.init();
+	gps.init();
+	mrf.init();
+	uartSerial.init();
+	console.init();
+
+	console.print(Info, "\n>>> HOST SYSTEM INIT <<<\n");
+
+	const uint32_t uniqId = argc > 1 ? strtoul(argv[1], NULL, 16) : getpid();
+	console.print(Info, "\n\n>>>>> Unique system Id: %x <<<<<<\n\n\n", uniqId);
+
+	// Run activities on the shared executor
+	if(argc > 3) {
+		const size_t workers = strtoul(argv[3], NULL, 10);
+		console.print(Info, ">>> Running activities on %u executor workers\n", (unsigned) workers);
+		CDEECO::Executor::setDefault(new CDEECO::Executor(workers));
+	}
+
+	// Initialize user defined CDEECO++ system
+	cdeecoSetup(uniqId);
+
+	// Rate-monotonic priorities, schedulability checked once the execution times are measured
+	CDEECO::PriorityAssignment::assign();
+	new CDEECO::PriorityAssignment(5000);
+
+	if(argc > 2)
+		new Shutdown(strtoul(argv[2], NULL, 10));
+
+	// Start the scheduler.
+	console.print(Info, ">>> Running scheduler\n");
+	vTaskStartScheduler();
+
+	console.print(Info, ">>> Scheduler ended\n");
+
+	// Memory and context switches taken by the tasks, compares the execution modes
+	HostStats stats;
+	vHostGetStats(&stats);
+	console.print(Info, ">>> Runtime: %u tasks, %u B of task stacks, %u blocking waits\n", (unsigned) stats.tasks,
+			(unsigned) stats.stackBytes, (unsigned) stats.blocks);
+
+	// Stack usage measured on the painted host stacks
+	CDEECO::StackMonitor::report();
+	fflush(stdout);
+
+	// Tasks are still running, do not run static destructors under them
+	_exit(0);
+}
@@ -0,0 +1,32 @@
+/**
+ * \ingroup host
+ * @file stm32f4xx.cpp
+ *
+ * Host emulation of the STM32F4 peripherals used by the drivers
+ *
+ * \date 16. 10. 2026
+ */
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "stm32f4xx.h"
+
+USART_TypeDef HostUSART[6];
+
+HostUSARTDataRegister &HostUSARTDataRegister::operator=(uint16_t value) {
+	putchar(value);
+	if(value == '\n')
+		fflush(stdout);
+	return *this;
+}
+
+HostUSARTDataRegister::operator uint16_t() const {
+	return 0;
+}
+
+void assert_failed(uint8_t* file, uint32_t line) {
+	fflush(stdout);
+	fprintf(stderr, "\n\n\n#### Assert failed ####\nFile: %s:%u\n\n\n", (char*) file, line);
+	abort();
+}
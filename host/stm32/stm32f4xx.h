@@ -0,0 +1,123 @@
+/**
+ * \ingroup host
+ * @file stm32f4xx.h
+ *
+ * Host replacement of the STM32F4 device header
+ *
+ * Declares just enough of the peripheral types for the driver headers to compile. Peripherals are not emulated,
+ * except for the USART data register which forwards transmitted characters to the standard output. This way the
+ * Console driver can be used on the host without modification.
+ *
+ * \date 16. 10. 2026
+ */
+
+#ifndef __STM32F4xx_H
+#define __STM32F4xx_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/// Peripheral enable state
+typedef enum {
+	DISABLE = 0, ENABLE = !DISABLE
+} FunctionalState;
+
+/// Interrupt numbers used by the application
+typedef enum IRQn {
+	EXTI0_IRQn = 6,
+	EXTI2_IRQn = 8,
+	TIM1_UP_TIM10_IRQn = 25,
+	USART2_IRQn = 38,
+	SPI3_IRQn = 51,
+	TIM6_DAC_IRQn = 54,
+	TIM7_IRQn = 55,
+	USART6_IRQn = 71
+} IRQn_Type;
+
+/// General purpose IO registers
+typedef struct {
+	volatile uint32_t MODER;
+	volatile uint32_t IDR;
+	volatile uint32_t ODR;
+} GPIO_TypeDef;
+
+/// SPI registers
+typedef struct {
+	volatile uint16_t SR;
+	volatile uint16_t DR;
+} SPI_TypeDef;
+
+/// Timer registers
+typedef struct {
+	volatile uint32_t CNT;
+} TIM_TypeDef;
+
+/**
+ * Emulated USART data register
+ *
+ * Characters written to the register are printed to the standard output. Reads return 0 as there is no input.
+ */
+class HostUSARTDataRegister {
+public:
+	/**
+	 * Transmit character
+	 *
+	 * @param value Character to transmit
+	 * @return Reference to this register
+	 */
+	HostUSARTDataRegister &operator=(uint16_t value);
+
+	/**
+	 * Receive character
+	 *
+	 * @return Always 0
+	 */
+	operator uint16_t() const;
+};
+
+/// USART registers
+typedef struct {
+	volatile uint16_t SR;
+	HostUSARTDataRegister DR;
+} USART_TypeDef;
+
+/// Emulated USART instances
+extern USART_TypeDef HostUSART[6];
+
+#define GPIOA	((GPIO_TypeDef *) 0x40020000)
+#define GPIOB	((GPIO_TypeDef *) 0x40020400)
+#define GPIOC	((GPIO_TypeDef *) 0x40020800)
+#define GPIOD	((GPIO_TypeDef *) 0x40020C00)
+#define GPIOE	((GPIO_TypeDef *) 0x40021000)
+
+#define USART2	(&HostUSART[1])
+#define USART6	(&HostUSART[5])
+
+#define USART_FLAG_TXE		((uint16_t)0x0080)
+#define USART_FLAG_TC		((uint16_t)0x0040)
+#define USART_FLAG_RXNE		((uint16_t)0x0020)
+#define USART_FLAG_ORE		((uint16_t)0x0008)
+#define USART_FLAG_FE		((uint16_t)0x0002)
+#define USART_FLAG_PE		((uint16_t)0x0001)
+
+#define SPI_I2S_FLAG_RXNE	((uint16_t)0x0001)
+
+#define RCC_AHB1Periph_GPIOA	((uint32_t)0x00000001)
+#define RCC_AHB1Periph_GPIOB	((uint32_t)0x00000002)
+#define RCC_AHB1Periph_GPIOC	((uint32_t)0x00000004)
+#define RCC_AHB1Periph_GPIOD	((uint32_t)0x00000008)
+#define RCC_AHB1Periph_GPIOE	((uint32_t)0x00000010)
+
+#include "stm32f4xx_gpio.h"
+
+/**
+ * Reports the name of the source file and the source line number where the assert_param error has occurred
+ *
+ * @param file Source file name
+ * @param line Source file line
+ */
+void assert_failed(uint8_t* file, uint32_t line);
+
+#define assert_param(expr) ((expr) ? (void)0 : assert_failed((uint8_t *)__FILE__, __LINE__))
+
+#endif // __STM32F4xx_H
@@ -0,0 +1,82 @@
+/**
+ * \ingroup cdeeco
+ * @file Activity.cpp
+ *
+ * Framework activity implementation
+ *
+ * \date 16. 10. 2026
+ */
+
+#include "Activity.h"
+
+#include "main.h"
+
+namespace CDEECO {
+	Activity *Activity::first = NULL;
+
+	Activity::Activity(const size_t stack, const unsigned long priority, const char *name, const bool timed) :
+			Job(priority, timed), executor(Executor::getDefault()), name(name) {
+		// Append to the list of activities
+		taskENTER_CRITICAL();
+		Activity **position = &first;
+		while(*position != NULL)
+			position = &(*position)->next;
+		*position = this;
+		taskEXIT_CRITICAL();
+
+		if(executor != NULL)
+			executor->add(*this);
+		else
+			thread = new Thread(*this, stack, priority, name);
+	}
+
+	Activity::~Activity() {
+		assert_param(executor == NULL);
+		delete thread;
+
+		taskENTER_CRITICAL();
+		Activity **position = &first;
+		while(*position != this)
+			position = &(*position)->next;
+		*position = next;
+		taskEXIT_CRITICAL();
+	}
+
+	const char *Activity::getName() const {
+		return name;
+	}
+
+	Executor *Activity::getExecutor() const {
+		return executor;
+	}
+
+	const PeriodicSchedule *Activity::getSchedule() const {
+		return schedule;
+	}
+
+	void Activity::setPriority(const unsigned long priority) {
+		if(executor != NULL) {
+			executor->setPriority(*this, priority);
+		} else {
+			this->priority = priority;
+			thread->setPriority(priority);
+		}
+	}
+
+	void Activity::setDeadline(const uint32_t deadlineMs) {
+		assert_param(schedule != NULL);
+		schedule->setDeadline(deadlineMs);
+	}
+
+	Activity *Activity::getFirst() {
+		return first;
+	}
+
+	Activity *Activity::getNext() const {
+		return next;
+	}
+
+	void Activity::setSchedule(PeriodicSchedule &schedule) {
+		this->schedule = &schedule;
+	}
+}
@@ -0,0 +1,157 @@
+/**
+ * \ingroup cdeeco
+ * @file Activity.h
+ *
+ * Framework activity running either in its own task or as a job of the shared executor
+ *
+ * \date 16. 10. 2026
+ */
+
+#ifndef ACTIVITY_H
+#define ACTIVITY_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "Executor.h"
+#include "PeriodicSchedule.h"
+#include "wrappers/FreeRTOSTask.h"
+
+namespace CDEECO {
+	/**
+	 * Framework activity
+	 *
+	 * The activity runs as a job of the default executor when one is installed at its creation. Otherwise it runs
+	 * in its own task. Activities implement both, the run loop and the job steps. Activities are listed in the order
+	 * of creation, periodic activities expose their schedule for the priority assignment.
+	 *
+	 * \ingroup cdeeco
+	 */
+	class Activity: public Job {
+	public:
+		/**
+		 * Create activity
+		 *
+		 * @param stack Stack size of the activity's own task in words
+		 * @param priority Activity priority, relative to tskIDLE_PRIORITY as the FreeRTOSTask priorities
+		 * @param name Name of the activity's own task
+		 * @param timed Whenever the job steps are due at the returned time, false for the activities run by trigger
+		 */
+		Activity(const size_t stack, const unsigned long priority, const char *name, const bool timed = true);
+
+		/**
+		 * Destroy activity
+		 *
+		 * Activities running as jobs cannot be destroyed.
+		 */
+		virtual ~Activity();
+
+		/**
+		 * Get activity name
+		 *
+		 * @return Activity name
+		 */
+		const char *getName() const;
+
+		/**
+		 * Get executor running the activity
+		 *
+		 * @return Executor or NULL when the activity runs in its own task
+		 */
+		Executor *getExecutor() const;
+
+		/**
+		 * Get schedule of periodic activity
+		 *
+		 * @return Schedule or NULL when the activity is not periodic
+		 */
+		const PeriodicSchedule *getSchedule() const;
+
+		/**
+		 * Set priority
+		 *
+		 * @param priority New activity priority
+		 */
+		void setPriority(const unsigned long priority);
+
+		/**
+		 * Set relative deadline of periodic activity
+		 *
+		 * @param deadlineMs Deadline after release in milliseconds, 0 for deadline equal to the period
+		 */
+		void setDeadline(const uint32_t deadlineMs);
+
+		/**
+		 * Get first created activity
+		 *
+		 * @return First activity, NULL when there is none
+		 */
+		static Activity *getFirst();
+
+		/**
+		 * Get next created activity
+		 *
+		 * @return Next activity, NULL for the last one
+		 */
+		Activity *getNext() const;
+
+	protected:
+		/// Executor running this activity, NULL when the activity runs in its own task
+		Executor * const executor;
+
+		/**
+		 * Activity body when running in its own task
+		 */
+		virtual void run() = 0;
+
+		/**
+		 * Set schedule of periodic activity
+		 *
+		 * @param schedule Schedule releasing the activity
+		 */
+		void setSchedule(PeriodicSchedule &schedule);
+
+	private:
+		/**
+		 * Own task of the activity
+		 */
+		class Thread: FreeRTOSTask {
+		public:
+			/**
+			 * Create activity task
+			 *
+			 * @param activity Activity to run
+			 * @param stack Task stack size in words
+			 * @param priority Task priority
+			 * @param name Task name
+			 */
+			Thread(Activity &activity, const size_t stack, const unsigned long priority, const char *name) :
+					FreeRTOSTask(stack, priority, name), activity(activity) {
+			}
+
+			using FreeRTOSTask::setPriority;
+
+		private:
+			/// Activity to run
+			Activity &activity;
+
+			void run() {
+				activity.run();
+			}
+		};
+
+		/// First created activity
+		static Activity *first;
+
+		/// Activity name
+		const char * const name;
+		/// Own task of the activity, NULL when the activity runs as a job
+		Thread *thread = NULL;
+		/// Schedule of periodic activity, NULL for other activities
+		PeriodicSchedule *schedule = NULL;
+		/// Next created activity
+		Activity *next = NULL;
+	};
+}
+
+#endif // ACTIVITY_H
@@ -30,8 +30,20 @@ namespace CDEECO {
 		 * Broadcast fragment
 		 *
 		 * @param fragment KnowledgeFragment to broadcast
+		 * @return Whenever the fragment was queued for transmission, false when it was dropped
 		 */
-		virtual void broadcastFragment(const KnowledgeFragment fragment) = 0;
+		virtual bool broadcastFragment(const KnowledgeFragment &fragment) = 0;
+
+		/**
+		 * Get number of fragments received from the air
+		 *
+		 * Used to estimate the number of neighbours.
+		 *
+		 * @return Number of received fragments, 0 when not known
+		 */
+		virtual uint32_t getReceivedCount() {
+			return 0;
+		}
 	};
 }
 
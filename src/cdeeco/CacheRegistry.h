@@ -0,0 +1,233 @@
+/**
+ * \ingroup cdeeco
+ * @file CacheRegistry.h
+ *
+ * Knowledge cache registries used by the system to dispatch received knowledge fragments
+ *
+ * \date 16. 10. 2026
+ *
+ * CacheSlots is the runtime registry. It holds pointers to caches registered using the KnowledgeStorage interface and
+ * offers every fragment to every cache. Each cache checks the fragment type on its own, thus each fragment costs
+ * one virtual call per registered cache.
+ *
+ * CacheRegistry is the compile-time registry. The cache types are passed as template arguments and the caches are
+ * held by value. The table of cache types is sorted at compile time and the fragment is dispatched to the single
+ * matching cache by binary search and a direct call. Duplicate cache types are reported at compile time.
+ */
+
+#ifndef CACHE_REGISTRY_H
+#define CACHE_REGISTRY_H
+
+#include <array>
+#include <tuple>
+#include <utility>
+
+#include "main.h"
+#include "KnowledgeCache.h"
+#include "KnowledgeFragment.h"
+
+namespace CDEECO {
+	/**
+	 * Runtime knowledge cache registry
+	 *
+	 * @tparam SIZE Number of cache slots
+	 *
+	 * \ingroup cdeeco
+	 */
+	template<size_t SIZE>
+	class CacheSlots {
+	public:
+		/**
+		 * Cache slots constructor
+		 */
+		CacheSlots() {
+			caches.fill(NULL);
+		}
+
+		/**
+		 * Register knowledge cache
+		 *
+		 * This adds cache to fixed array of caches. When there is out of space
+		 * in the array the application is stopped on assert.
+		 *
+		 * @param cache Knowledge cache to be added
+		 */
+		void registerCache(KnowledgeStorage *cache) {
+			assert_param(caches[caches.size() - 1] == NULL);
+
+			for(size_t i = 0; i < SIZE; ++i)
+				if(caches[i] == NULL) {
+					caches[i] = cache;
+					return;
+				}
+
+			console.print(Error, ">>>> OUT OF CACHE STORAGE <<<<\n");
+			assert_param(false);
+		}
+
+		/**
+		 * Store fragment in all registered caches
+		 *
+		 * @param fragment Knowledge fragment to store
+		 */
+		void storeFragment(const KnowledgeFragment &fragment) {
+			for(size_t i = 0; i < caches.size() && caches[i]; ++i)
+				caches[i]->storeFragment(fragment);
+		}
+
+	private:
+		/// Array with assigned caches
+		std::array<KnowledgeStorage*, SIZE> caches;
+	};
+
+	/**
+	 * Compile-time knowledge cache registry
+	 *
+	 * @tparam CACHES KnowledgeCache instances held by the registry, each with unique knowledge type
+	 *
+	 * \ingroup cdeeco
+	 */
+	template<typename ... CACHES>
+	class CacheRegistry {
+	public:
+		/// Number of caches in the registry
+		static const size_t SIZE = sizeof...(CACHES);
+
+		static_assert(SIZE > 0, "Cache registry has to hold at least one cache.");
+
+		/**
+		 * Cache registry constructor
+		 */
+		CacheRegistry() {
+			static_assert(unique(), "Cache registry holds more caches of the same knowledge type.");
+		}
+
+		/**
+		 * Store fragment in cache of matching knowledge type
+		 *
+		 * Fragments of types without cache are dropped.
+		 *
+		 * @param fragment Knowledge fragment to store
+		 */
+		void storeFragment(const KnowledgeFragment &fragment) {
+			// Binary search for first entry not lower than fragment type
+			size_t low = 0;
+			size_t high = SIZE;
+			while(low < high) {
+				const size_t mid = (low + high) / 2;
+				if(table.entries[mid].type < fragment.type)
+					low = mid + 1;
+				else
+					high = mid;
+			}
+
+			if(low < SIZE && table.entries[low].type == fragment.type)
+				table.entries[low].store(caches, fragment);
+		}
+
+		/**
+		 * Get cache for knowledge type
+		 *
+		 * @tparam TYPE Knowledge type magic
+		 * @return Reference to the cache holding knowledge of type TYPE
+		 */
+		template<Type TYPE>
+		auto &getCache() {
+			static_assert(indexOf(TYPE) < SIZE, "No cache for requested knowledge type.");
+			return std::get<indexOf(TYPE)>(caches);
+		}
+
+	private:
+		/// Tuple of held caches
+		typedef std::tuple<CACHES...> Caches;
+		/// Store function for single cache
+		typedef void (*Store)(Caches &caches, const KnowledgeFragment &fragment);
+
+		/// Dispatch table entry
+		struct Entry {
+			/// Knowledge type stored by the cache
+			Type type;
+			/// Store function of the cache
+			Store store;
+		};
+
+		/// Dispatch table sorted by knowledge type
+		struct Table {
+			/// Table entries
+			Entry entries[SIZE];
+		};
+
+		/// Dispatch table instance
+		static const Table table;
+
+		/// Held caches
+		Caches caches;
+
+		/**
+		 * Store fragment in cache at index
+		 *
+		 * @tparam INDEX Index of the cache in the tuple
+		 * @param caches Tuple of caches
+		 * @param fragment Knowledge fragment to store
+		 */
+		template<size_t INDEX>
+		static void store(Caches &caches, const KnowledgeFragment &fragment) {
+			std::get<INDEX>(caches).insertFragment(fragment);
+		}
+
+		/**
+		 * Create dispatch table sorted by knowledge type
+		 *
+		 * @return Sorted dispatch table
+		 */
+		template<size_t ... INDICES>
+		static constexpr Table makeTable(std::index_sequence<INDICES...>) {
+			Table table = { { { CACHES::CacheType, &store<INDICES> }... } };
+
+			// Insertion sort by type
+			for(size_t i = 1; i < SIZE; ++i) {
+				for(size_t j = i; j > 0 && table.entries[j - 1].type > table.entries[j].type; --j) {
+					const Entry entry = table.entries[j];
+					table.entries[j] = table.entries[j - 1];
+					table.entries[j - 1] = entry;
+				}
+			}
+
+			return table;
+		}
+
+		/**
+		 * Get cache index for knowledge type
+		 *
+		 * @param type Knowledge type magic
+		 * @return Index of the cache in the tuple or SIZE when not found
+		 */
+		static constexpr size_t indexOf(const Type type) {
+			const Type types[] = { CACHES::CacheType... };
+			for(size_t i = 0; i < SIZE; ++i)
+				if(types[i] == type)
+					return i;
+			return SIZE;
+		}
+
+		/**
+		 * Check whenever all caches hold different knowledge types
+		 *
+		 * @return True when types are unique
+		 */
+		static constexpr bool unique() {
+			const Type types[] = { CACHES::CacheType... };
+			for(size_t i = 0; i < SIZE; ++i)
+				for(size_t j = i + 1; j < SIZE; ++j)
+					if(types[i] == types[j])
+						return false;
+			return true;
+		}
+	};
+
+	template<typename ... CACHES>
+	const typename CacheRegistry<CACHES...>::Table CacheRegistry<CACHES...>::table = CacheRegistry<CACHES...>::makeTable(
+			std::index_sequence_for<CACHES...>());
+}
+
+#endif // CACHE_REGISTRY_H
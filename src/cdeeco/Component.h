@@ -14,13 +14,20 @@
 #include "FreeRTOS.h"
 #include "semphr.h"
 
-#include <climits>
+#include <algorithm>
+#include <atomic>
+#include <bitset>
 
 #include "System.h"
 #include "Knowledge.h"
-#include "ListedTriggerTask.h"
+#include "TriggerIndex.h"
 #include "KnowledgeFragment.h"
+#include "FragmentPlan.h"
+#include "PeriodicSchedule.h"
+#include "Activity.h"
+#include "StackSizes.h"
 #include "wrappers/FreeRTOSMutex.h"
+#include "wrappers/FreeRTOSSemaphore.h"
 
 namespace CDEECO {
 	/**
@@ -31,8 +38,13 @@ namespace CDEECO {
 	 * \ingroup cdeeco
 	 */
 	template<typename KNOWLEDGE>
-	class Component: FreeRTOSTask {
+	class Component: Activity {
 	public:
+		/// Number of fragments received in a period that stretch the adaptive period by one base period
+		static const uint32_t DENSITY_FRAGMENTS = 20;
+		/// Number of lock-free knowledge copy attempts before the reader falls back to the knowledge lock
+		static const size_t LOCK_FREE_READ_ATTEMPTS = 3;
+
 		/**
 		 * Component constructor
 		 *
@@ -43,8 +55,9 @@ namespace CDEECO {
 		 */
 		Component(const CDEECO::Id id, const CDEECO::Type type, Broadcaster &broadcaster,
 				const uint32_t broadcastPeriodMs = 3000) :
-				id(id), type(type), broadcaster(broadcaster), rootTriggerTask(NULL), broadcastPeriodMs(
-						broadcastPeriodMs) {
+				Activity(CDEECO_COMPONENT_STACK, FreeRTOSTask::DEFAULT_PRIORITY, "Component"), id(id), type(type), broadcaster(broadcaster), broadcastPeriodMs(broadcastPeriodMs), basePeriodMs(
+						broadcastPeriodMs), broadcastSchedule(broadcastPeriodMs), version(0) {
+			setSchedule(broadcastSchedule);
 		}
 
 		/**
@@ -53,13 +66,63 @@ namespace CDEECO {
 		 * @return Consistent copy of components knowledge
 		 */
 		KNOWLEDGE lockReadKnowledge() {
-			knowledgeMutex.lock();
-			KNOWLEDGE in = knowledge;
-			knowledgeMutex.unlock();
+			return lockReadKnowledge(knowledge);
+		}
 
+		/**
+		 * Lock knowledge and obtain copy of its part
+		 *
+		 * Only the requested part is copied, thus the knowledge is locked for shorter time.
+		 *
+		 * @tparam IN_KNOWLEDGE Type of knowledge being read
+		 * @param inKnowledge Reference to input knowledge to be read
+		 * @return Consistent copy of inKnowledge
+		 */
+		template<typename IN_KNOWLEDGE>
+		IN_KNOWLEDGE lockReadKnowledge(const IN_KNOWLEDGE &inKnowledge) {
+			IN_KNOWLEDGE in;
+			lockReadKnowledge(in, inKnowledge);
 			return in;
 		}
 
+		/**
+		 * Lock knowledge and copy its part into the target
+		 *
+		 * Lets the caller keep the copy outside of its stack. With lock-free reads enabled the part is copied without
+		 * the lock and the copy is retried when a write happened meanwhile.
+		 *
+		 * @tparam IN_KNOWLEDGE Type of knowledge being read
+		 * @param in Target for the consistent copy of inKnowledge
+		 * @param inKnowledge Reference to input knowledge to be read
+		 */
+		template<typename IN_KNOWLEDGE>
+		void lockReadKnowledge(IN_KNOWLEDGE &in, const IN_KNOWLEDGE &inKnowledge) {
+			assert_param(
+					(size_t) &inKnowledge >= (size_t) &knowledge
+							&& (size_t) &inKnowledge + sizeof(IN_KNOWLEDGE)
+									<= (size_t) &knowledge + sizeof(KNOWLEDGE));
+
+			if(lockFreeReads) {
+				for(size_t attempt = 0; attempt < LOCK_FREE_READ_ATTEMPTS; ++attempt) {
+					// Writer in progress, wait for it on the lock
+					const uint32_t before = sequence.load(std::memory_order_acquire);
+					if(before & 1)
+						break;
+
+					in = inKnowledge;
+
+					// Copy is consistent when no write started meanwhile
+					std::atomic_thread_fence(std::memory_order_acquire);
+					if(sequence.load(std::memory_order_relaxed) == before)
+						return;
+				}
+			}
+
+			knowledgeMutex.lock();
+			in = inKnowledge;
+			knowledgeMutex.unlock();
+		}
+
 		/**
 		 * Lock knowledge and update it
 		 *
@@ -77,40 +140,65 @@ namespace CDEECO {
 			knowledgeMutex.lock();
 
 			// Check and update knowledge
-			bool changed = memcmp(&outKnowledge, &knowledgeData, sizeof(OUT_KNOWLEDGE)) != 0;
+			const bool changed = memcmp(&outKnowledge, &knowledgeData, sizeof(OUT_KNOWLEDGE)) != 0;
+			bool stage = false;
+			typename TriggerIndex<KNOWLEDGE>::Mask triggered = 0;
 			if(changed) {
-				// Update knowledge
-				outKnowledge = knowledgeData;
+				// Mark changed fields and collect tasks watching them
+				triggered = markChanged(((size_t) &outKnowledge) - ((size_t) &knowledge), sizeof(OUT_KNOWLEDGE), &knowledgeData);
 
-				// Broadcast updated knowledge fragments
-				broadcastChange(((size_t) &outKnowledge) - ((size_t) &knowledge), sizeof(OUT_KNOWLEDGE));
+				// Update knowledge, odd sequence tells lock-free readers the write is in progress
+				const uint32_t seq = sequence.load(std::memory_order_relaxed);
+				sequence.store(seq + 1, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_release);
+				outKnowledge = knowledgeData;
+				sequence.store(seq + 2, std::memory_order_release);
+				version++;
+
+				// Broadcast updated knowledge fragments now or when the coalescing window closes
+				if(coalescingWindowMs == 0) {
+					stage = true;
+				} else if(!windowOpen) {
+					windowOpen = true;
+					windowEnd = xTaskGetTickCount() + coalescingWindowMs / portTICK_PERIOD_MS;
+					if(executor != NULL)
+						executor->trigger(*this);
+					else
+						wakeup.give();
+				}
 			}
 
 			knowledgeMutex.unlock();
 
-			if(changed)
-				checkAndRunTriggeredTasks(outKnowledge);
+			// Broadcast without blocking the knowledge readers, changes staged by other writer meanwhile are skipped
+			if(stage) {
+				broadcastMutex.lock();
+				knowledgeMutex.lock();
+				stageDirty();
+				knowledgeMutex.unlock();
+				broadcastStaged();
+				broadcastMutex.unlock();
+			}
+
+			triggers.fire(triggered);
 		}
 
 		/**
 		 * Add triggerd task to this component
 		 *
-		 * Component will call checkTriggerCOndition on this task when knowledge changes
+		 * Component will fire the task when any part of the trigger knowledge changes. Has to be called before the
+		 * knowledge is written for the first time.
 		 *
+		 * @tparam TRIGGER_KNOWLEDGE Type of trigger knowledge
 		 * @param task Task to add
+		 * @param trigger Reference to trigger knowledge in the component's knowledge
 		 */
-		void addTriggeredTask(ListedTriggerTask &task) {
-			// Install new list head
-			if(rootTriggerTask == NULL) {
-				rootTriggerTask = &task;
-				return;
-			}
-
-			// Add to the end of the list
-			ListedTriggerTask *root = rootTriggerTask;
-			while(root->next != NULL)
-				root = root->next;
-			root->next = &task;
+		template<typename TRIGGER_KNOWLEDGE>
+		void addTriggeredTask(Triggerable &task, const TRIGGER_KNOWLEDGE &trigger) {
+			assert_param(
+					(size_t) &trigger >= (size_t) &knowledge
+							&& (size_t) &trigger + sizeof(TRIGGER_KNOWLEDGE) <= (size_t) &knowledge + sizeof(KNOWLEDGE));
+			triggers.add(task, ((size_t) &trigger) - ((size_t) &knowledge), sizeof(TRIGGER_KNOWLEDGE));
 		}
 
 		/**
@@ -131,6 +219,121 @@ namespace CDEECO {
 			return type;
 		}
 
+		/**
+		 * Enable delta encoded broadcasts
+		 *
+		 * Broadcasted fragments then carry only the difference to the data broadcasted previously for the same
+		 * knowledge range. Every keyframePeriod-th periodic broadcast sends plain data to allow nodes that missed
+		 * previous broadcasts to catch up.
+		 *
+		 * @param keyframePeriod Number of periodic broadcasts in between plain broadcasts, 0 disables delta encoding
+		 */
+		void setDeltaEncoding(const uint32_t keyframePeriod) {
+			knowledgeMutex.lock();
+			this->keyframePeriod = keyframePeriod;
+			periodicBroadcasts = 0;
+			deltaReady = false;
+			knowledgeMutex.unlock();
+		}
+
+		/**
+		 * Enable adaptive broadcast period
+		 *
+		 * The period is halved after a period with knowledge change and doubled after a period without change, but
+		 * it is kept in between the limits. The period is further stretched by one base period for each
+		 * DENSITY_FRAGMENTS fragments received from the air during the last period, as many neighbours share the
+		 * channel. Priorities are assigned by the minimal period, thus it has to be enabled before the assignment.
+		 *
+		 * @param minPeriodMs Minimal broadcast period in milliseconds
+		 * @param maxPeriodMs Maximal broadcast period in milliseconds, 0 disables the adaptive period
+		 */
+		void setAdaptivePeriod(const uint32_t minPeriodMs, const uint32_t maxPeriodMs) {
+			assert_param((minPeriodMs > 0 && minPeriodMs <= maxPeriodMs) || maxPeriodMs == 0);
+			knowledgeMutex.lock();
+			this->minPeriodMs = minPeriodMs;
+			this->maxPeriodMs = maxPeriodMs;
+			if(maxPeriodMs != 0)
+				basePeriodMs = std::max(minPeriodMs, std::min(maxPeriodMs, basePeriodMs));
+			broadcastSchedule.setMinPeriod(maxPeriodMs != 0 ? minPeriodMs : 0);
+			knowledgeMutex.unlock();
+		}
+
+		/**
+		 * Get current broadcast period
+		 *
+		 * @return Effective knowledge broadcast period in milliseconds
+		 */
+		uint32_t getBroadcastPeriod() {
+			return broadcastPeriodMs;
+		}
+
+		/**
+		 * Get timing statistics of periodic broadcasts
+		 *
+		 * The execution time covers staging and broadcasting of the knowledge fragments.
+		 *
+		 * @return Activation jitter, execution time and overruns of the periodic broadcasts
+		 */
+		TimingStats getBroadcastTimingStats() {
+			return broadcastSchedule.getStats();
+		}
+
+		/**
+		 * Set write coalescing window
+		 *
+		 * The first knowledge change opens the window. Changes written while the window is open are merged and
+		 * broadcasted once when the window closes. The window is not extended by the later changes, thus the
+		 * broadcast is delayed at most by the window length. Triggered tasks are not delayed.
+		 *
+		 * @param windowMs Window length in milliseconds, 0 broadcasts each change immediately
+		 */
+		void setCoalescingWindow(const uint32_t windowMs) {
+			knowledgeMutex.lock();
+			coalescingWindowMs = windowMs;
+			knowledgeMutex.unlock();
+		}
+
+		/**
+		 * Set refresh period of unchanged knowledge
+		 *
+		 * Periodic broadcasts in between the refreshes send only the knowledge fragments changed and not broadcasted
+		 * since. Keyframes of delta encoding are always full broadcasts.
+		 *
+		 * @param refreshPeriod Number of periodic broadcasts in between full broadcasts, 1 broadcasts full knowledge
+		 * each period
+		 */
+		void setRefreshPeriod(const uint32_t refreshPeriod) {
+			assert_param(refreshPeriod > 0);
+			knowledgeMutex.lock();
+			this->refreshPeriod = refreshPeriod;
+			knowledgeMutex.unlock();
+		}
+
+		/**
+		 * Enable lock-free knowledge reads
+		 *
+		 * Readers then copy the knowledge without taking the knowledge lock, thus they are not blocked by writers
+		 * broadcasting the change. Readers retry the copy when a write happened meanwhile and fall back to the lock
+		 * when a write is in progress, so a high priority reader does not spin on a preempted writer. Writes are
+		 * serialized by the lock in both cases.
+		 *
+		 * Has to be set before the tasks and ensembles using the component are started.
+		 *
+		 * @param enable Whenever to read knowledge without the lock
+		 */
+		void setLockFreeReads(const bool enable) {
+			lockFreeReads = enable;
+		}
+
+		/**
+		 * Get knowledge version
+		 *
+		 * @return Version of the component's knowledge, incremented on each change
+		 */
+		Version getVersion() {
+			return version;
+		}
+
 		/// Knowledge of the component
 		KNOWLEDGE knowledge;
 
@@ -141,6 +344,9 @@ namespace CDEECO {
 		const Type type;
 
 	private:
+		/// Fragmentation plan of the knowledge
+		typedef FragmentPlan<KNOWLEDGE> Plan;
+
 		/**
 		 * Reference to this component's broadcaster
 		 *
@@ -149,101 +355,385 @@ namespace CDEECO {
 		Broadcaster &broadcaster;
 		/// Knowledge access mutex
 		FreeRTOSMutex knowledgeMutex;
-		/// Root of linked list of triggered tasks
-		ListedTriggerTask *rootTriggerTask;
+		/**
+		 * Staged fragments access mutex
+		 *
+		 * Locked before the knowledge lock when staging and unlocked once the staged fragments are broadcasted, thus
+		 * the fragments are broadcasted in the order of knowledge changes. The knowledge lock is never held while
+		 * waiting for this one, thus readers do not wait for broadcasts in progress.
+		 */
+		FreeRTOSMutex broadcastMutex;
+		/// Fragments staged under the knowledge lock to be broadcasted after unlocking
+		KnowledgeFragment staged[Plan::COUNT];
+		/// Number of staged fragments
+		size_t stagedCount = 0;
+		/// Knowledge write sequence, odd while the knowledge is being written
+		std::atomic<uint32_t> sequence { 0 };
+		/// Whenever readers copy the knowledge without the lock
+		bool lockFreeReads = false;
+		/// Triggered tasks indexed by the watched knowledge
+		TriggerIndex<KNOWLEDGE> triggers;
 		/// Interval between knowledge broadcasts
-		const uint32_t broadcastPeriodMs;
+		uint32_t broadcastPeriodMs;
+		/// Adaptive broadcast period before stretching by neighbour density
+		uint32_t basePeriodMs;
+		/// Schedule of periodic broadcasts, accessed by the broadcast thread only
+		PeriodicSchedule broadcastSchedule;
+		/// Minimal adaptive broadcast period
+		uint32_t minPeriodMs = 0;
+		/// Maximal adaptive broadcast period, 0 when the period is not adaptive
+		uint32_t maxPeriodMs = 0;
+		/// Knowledge version at the last periodic broadcast
+		Version periodicVersion = 0;
+		/// Number of received fragments at the last periodic broadcast
+		uint32_t periodicReceived = 0;
+		/// Write coalescing window length, 0 when changes are broadcasted immediately
+		uint32_t coalescingWindowMs = 0;
+		/// Whenever the write coalescing window is open
+		bool windowOpen = false;
+		/// Time the write coalescing window closes
+		TickType_t windowEnd = 0;
+		/// Wakes the broadcast thread when the write coalescing window opens
+		FreeRTOSSemaphore wakeup = FreeRTOSSemaphore(1, 0);
+		/// Knowledge version
+		Version version;
+		/// Knowledge as broadcasted last time, base for delta encoded fragments
+		KNOWLEDGE broadcasted;
+		/// Number of periodic broadcasts in between plain broadcasts, 0 when delta encoding is disabled
+		uint32_t keyframePeriod = 0;
+		/// Number of periodic broadcasts since delta encoding was enabled
+		uint32_t periodicBroadcasts = 0;
+		/// Whenever plain knowledge was broadcasted, thus deltas can be applied by the receivers
+		bool deltaReady = false;
+		/// Number of periodic broadcasts in between full broadcasts
+		uint32_t refreshPeriod = 1;
+
+		/// Size of the knowledge block tracked by the dirty mask
+		static const size_t DIRTY_BLOCK_SIZE = 8;
+		/// Knowledge blocks changed and not broadcasted since
+		std::bitset<(sizeof(KNOWLEDGE) + DIRTY_BLOCK_SIZE - 1) / DIRTY_BLOCK_SIZE> dirty;
+
+		/**
+		 * Mark knowledge range as changed
+		 *
+		 * @param start Range start relative to knowledge
+		 * @param size Range size
+		 */
+		void markDirty(const size_t start, const size_t size) {
+			for(size_t block = start / DIRTY_BLOCK_SIZE; block * DIRTY_BLOCK_SIZE < start + size; ++block)
+				dirty.set(block);
+		}
+
+		/**
+		 * Mark changed parts of the written range as changed
+		 *
+		 * Each field or array element described by KnowledgeFields that lies inside the written range is compared
+		 * separately. The parts of the range not described by the fields are compared block by block and only the
+		 * runs of changed bytes are marked, thus tasks watching unchanged bytes next to them are not fired.
+		 *
+		 * @param start Written range start relative to knowledge
+		 * @param size Written range size
+		 * @param data New data of the written range
+		 * @return Mask of triggered tasks watching the changed parts
+		 */
+		typename TriggerIndex<KNOWLEDGE>::Mask markChanged(const size_t start, const size_t size, const void *data) {
+			const char *current = (const char*) &knowledge;
+			const char *written = (const char*) data;
+			const size_t end = start + size;
+
+			typename TriggerIndex<KNOWLEDGE>::Mask triggered = 0;
+
+			// Compare field or element
+			auto compare = [&](const size_t from, const size_t to) {
+				if(from < to && memcmp(current + from, written + (from - start), to - from) != 0) {
+					markDirty(from, to - from);
+					triggered |= triggers.match(from, to - from);
+				}
+			};
+
+			// Compare undescribed part, changed blocks are searched for runs of changed bytes
+			auto compareBytes = [&](const size_t from, const size_t to) {
+				for(size_t block = from; block < to;) {
+					const size_t blockEnd = std::min(to, (block / DIRTY_BLOCK_SIZE + 1) * DIRTY_BLOCK_SIZE);
+					if(memcmp(current + block, written + (block - start), blockEnd - block) != 0) {
+						for(size_t i = block; i < blockEnd;) {
+							size_t j = i;
+							while(j < blockEnd && current[j] != written[j - start])
+								++j;
+							if(j > i) {
+								markDirty(i, j - i);
+								triggered |= triggers.match(i, j - i);
+								i = j;
+							} else {
+								++i;
+							}
+						}
+					}
+					block = blockEnd;
+				}
+			};
+
+			size_t pos = start;
+			for(const FieldDescriptor &field : KnowledgeFields<KNOWLEDGE>::fields()) {
+				if(field.offset + field.size <= start || field.offset >= end)
+					continue;
+
+				for(size_t i = 0; i < field.count; ++i) {
+					const size_t offset = field.offset + i * field.elementSize();
+					if(offset < pos || offset + field.elementSize() > end)
+						continue;
+
+					compareBytes(pos, offset);
+					compare(offset, offset + field.elementSize());
+					pos = offset + field.elementSize();
+				}
+			}
+			compareBytes(pos, end);
+			return triggered;
+		}
 
 		/**
-		 * Run triggered tasks
+		 * Mark knowledge range as broadcasted
 		 *
-		 * Run tasks that are triggered by specified change in the knowledge.
+		 * All the blocks touched by the range are cleared. Changes are staged in block aligned ranges, thus the other
+		 * fragments sharing a partially covered dirty block are staged together with the range.
 		 *
-		 * @tparam T Type of changed knowledge member
-		 * @param changed Reference to changed knowledge member
+		 * @param start Range start relative to knowledge
+		 * @param size Range size
 		 */
-		template<typename T>
-		void checkAndRunTriggeredTasks(T &changed) {
-			for(ListedTriggerTask *task = rootTriggerTask; task != NULL; task = task->next) {
-				task->checkTriggerCondition(changed);
+		void markClean(const size_t start, const size_t size) {
+			const size_t last = (start + size + DIRTY_BLOCK_SIZE - 1) / DIRTY_BLOCK_SIZE;
+			for(size_t block = start / DIRTY_BLOCK_SIZE; block < last; ++block)
+				dirty.reset(block);
+		}
+
+		/**
+		 * Stage changed knowledge not broadcasted yet
+		 *
+		 * Fragments covering more dirty blocks are staged once.
+		 */
+		void stageDirty() {
+			size_t broadcasted = 0;
+			for(size_t block = 0; block < dirty.size(); ++block) {
+				const size_t start = block * DIRTY_BLOCK_SIZE;
+				if(!dirty.test(block) || start < broadcasted)
+					continue;
+
+				// Find end of dirty block run
+				size_t end = block + 1;
+				while(end < dirty.size() && dirty.test(end))
+					end++;
+
+				broadcasted = stageChange(start, std::min(end * DIRTY_BLOCK_SIZE, sizeof(KNOWLEDGE)) - start);
 			}
 		}
 
 		/**
-		 * Broadcast knowledge change
+		 * Stage knowledge change
+		 *
+		 * Stages all planned fragments overlapping the change.
 		 *
 		 * @param start Change start relative to knowledge
 		 * @param size Change size
+		 * @param plain Whenever to broadcast plain data even when delta encoding is enabled
+		 * @return End of the staged knowledge range
 		 */
-		void broadcastChange(size_t start, size_t size) {
-			console.print(Debug, "Broadcasting local knowledge\n");
+		size_t stageChange(size_t start, size_t size, const bool plain = false) {
+			assert_param(size > 0 && start + size <= sizeof(KNOWLEDGE));
 
-			size_t end = start + size;
-			assert_param(end <= sizeof(KNOWLEDGE));
-
-			// Until the change is broadcasted
-			size_t cnt = 0;
-			size_t last = ULONG_MAX;
-			do {
-				// Find start offset
-				size_t brdStart = 0;
-
-				// If allowed offsets are defined then use only them
-				if(!KnowledgeTrait<KNOWLEDGE>::offsets.empty()) {
-					bool found = false;
-					for(size_t i = KnowledgeTrait<KNOWLEDGE>::offsets.size() - 1; i >= 0; --i) {
-						if(KnowledgeTrait<KNOWLEDGE>::offsets[i] <= start) {
-							assert_param(last != i);
-							last = i;
-							found = true;
-							brdStart = KnowledgeTrait<KNOWLEDGE>::offsets[i];
-							break;
-						}
-					}
-					assert_param(found);
+			const size_t first = Plan::fragmentOf(start);
+			const size_t last = Plan::fragmentOf(start + size - 1);
+			for(size_t i = first; i <= last; ++i)
+				stageFragment(Plan::getFragment(i), plain);
+
+			const typename Plan::Fragment &end = Plan::getFragment(last);
+			return end.start + end.size;
+		}
+
+		/**
+		 * Stage knowledge fragment
+		 *
+		 * Has to be called with both the knowledge and the staged fragments locked. The fragment is considered
+		 * broadcasted from now on.
+		 *
+		 * @param planned Planned fragment to stage
+		 * @param plain Whenever to broadcast plain data even when delta encoding is enabled
+		 */
+		void stageFragment(const typename Plan::Fragment &planned, const bool plain) {
+			assert_param(stagedCount < Plan::COUNT);
+			KnowledgeFragment &fragment = staged[stagedCount++];
+			fragment.id = id;
+			fragment.type = type;
+			fragment.version = version;
+			fragment.offset = planned.start;
+			fragment.delta = false;
+			const size_t length = planned.size;
+			fragment.size = length;
+
+			const char *current = &((char*) &knowledge)[planned.start];
+			if(keyframePeriod != 0) {
+				// Use delta when possible and remember broadcasted data
+				char *previous = &((char*) &broadcasted)[planned.start];
+				if(plain || !deltaReady || !fragment.setDelta(current, previous, length))
+					memcpy(fragment.data, current, length);
+				memcpy(previous, current, length);
+			} else {
+				memcpy(fragment.data, current, length);
+			}
 
-					// If allowed offsets are not defined then broadcast at will
-				} else {
-					brdStart = start;
+			markClean(planned.start, length);
+		}
+
+		/**
+		 * Broadcast staged fragments
+		 *
+		 * Has to be called with the staged fragments locked, but not the knowledge. Ranges of the fragments dropped by
+		 * the broadcaster are marked as changed again. The receivers miss the dropped data, thus deltas are disabled
+		 * until the next keyframe.
+		 */
+		void broadcastStaged() {
+			if(stagedCount == 0)
+				return;
+
+			console.print(Debug, "Broadcasting local knowledge\n");
+			uint16_t dropped[Plan::COUNT];
+			size_t droppedCount = 0;
+			for(size_t i = 0; i < stagedCount; ++i) {
+				console.print(Debug, ">>>> Broadcasting fragment %d of the changed knowledge\n", i);
+				if(!broadcaster.broadcastFragment(staged[i]))
+					dropped[droppedCount++] = staged[i].offset;
+			}
+			stagedCount = 0;
+
+			if(droppedCount != 0) {
+				knowledgeMutex.lock();
+				for(size_t i = 0; i < droppedCount; ++i) {
+					const typename Plan::Fragment &planned = Plan::getFragment(Plan::fragmentOf(dropped[i]));
+					markDirty(planned.start, planned.size);
 				}
+				deltaReady = false;
+				knowledgeMutex.unlock();
+			}
+		}
+
+		/**
+		 * Compute next adaptive broadcast period
+		 *
+		 * Has to be called with the knowledge locked.
+		 */
+		void adaptPeriod() {
+			const uint32_t received = broadcaster.getReceivedCount();
+			const uint32_t receivedInPeriod = received - periodicReceived;
+			periodicReceived = received;
 
-				// Check and notify
-				console.print(Debug, ">>>> Created fragment %d of the changed knowledge\n", cnt++);
+			const bool changed = version != periodicVersion;
+			periodicVersion = version;
 
-				// Broadcast fragment
-				start = brdStart + broadcastFragment(brdStart);
-			} while(start < end);
+			if(maxPeriodMs == 0)
+				return;
+
+			// Shorten period for changing knowledge, back off exponentially for stable knowledge
+			basePeriodMs = changed ? std::max(minPeriodMs, basePeriodMs / 2) : std::min(maxPeriodMs, basePeriodMs * 2);
+
+			// Stretch period in dense networks
+			const uint64_t stretched = (uint64_t) basePeriodMs * (DENSITY_FRAGMENTS + receivedInPeriod)
+					/ DENSITY_FRAGMENTS;
+			broadcastPeriodMs = std::min<uint64_t>(maxPeriodMs, stretched);
 		}
 
 		/**
-		 * Broadcast knowledge fragment
+		 * Get time of the next broadcast
 		 *
-		 * @param start Start fragment offset
-		 * @return Broadcasted knowledge data size
+		 * @return Time of the next periodic broadcast or of the write coalescing window close
 		 */
-		size_t broadcastFragment(size_t start) {
-			KnowledgeFragment fragment;
-			fragment.id = id;
-			fragment.type = type;
-			fragment.offset = start;
-			fragment.size = std::min(sizeof(KNOWLEDGE) - start, sizeof(fragment.data));
-			memcpy(fragment.data, &((char*) &knowledge)[start], fragment.size);
+		TickType_t nextBroadcast() {
+			knowledgeMutex.lock();
+			TickType_t wakeAt = broadcastSchedule.getRelease();
+			if(windowOpen && (int32_t) (windowEnd - wakeAt) < 0)
+				wakeAt = windowEnd;
+			knowledgeMutex.unlock();
+			return wakeAt;
+		}
 
-			broadcaster.broadcastFragment(fragment);
+		/**
+		 * Broadcast knowledge when due
+		 *
+		 * Broadcasts full knowledge every refreshPeriod periods and only the changed knowledge in between. Changes
+		 * merged by the write coalescing window are broadcasted when the window closes. Periodic broadcasts are
+		 * released at absolute times, thus the period does not drift by the broadcast time.
+		 */
+		void broadcastDue() {
+			// Delta base and dirty mask are shared with knowledge writes, thus stage under the knowledge lock
+			broadcastMutex.lock();
+			knowledgeMutex.lock();
 
-			return fragment.size;
+			const TickType_t time = xTaskGetTickCount();
+			const bool windowClosed = windowOpen && (int32_t) (time - windowEnd) >= 0;
+			if(windowClosed)
+				windowOpen = false;
+
+			const bool periodic = (int32_t) (time - broadcastSchedule.getRelease()) >= 0;
+			if(periodic) {
+				// Periodic broadcast, covers changes merged in the closed window too
+				broadcastSchedule.activated();
+				const uint32_t count = periodicBroadcasts++;
+				const bool keyframe = keyframePeriod != 0 && count % keyframePeriod == 0;
+				if(keyframe || count % refreshPeriod == 0)
+					stageChange(0, sizeof(KNOWLEDGE), keyframe);
+				else
+					stageDirty();
+				if(keyframe)
+					deltaReady = true;
+				adaptPeriod();
+				broadcastSchedule.setPeriod(broadcastPeriodMs);
+			} else if(windowClosed) {
+				// Broadcast changes merged in the closed window
+				stageDirty();
+			}
+
+			knowledgeMutex.unlock();
+			broadcastStaged();
+			broadcastMutex.unlock();
+
+			if(periodic)
+				broadcastSchedule.completed();
 		}
 
 		/**
-		 * Periodic full knowledge broadcast
+		 * Periodic knowledge broadcast
 		 */
 		void run() {
+			broadcastSchedule.start(broadcastPeriodMs);
 			while(true) {
-				// Wait for next execution time
-				vTaskDelay(this->broadcastPeriodMs / portTICK_PERIOD_MS);
-				broadcastChange(0, sizeof(KNOWLEDGE));
+				// Wait for next periodic broadcast or write coalescing window close
+				const TickType_t wakeAt = nextBroadcast();
+				const TickType_t now = xTaskGetTickCount();
+				if((int32_t) (wakeAt - now) > 0)
+					wakeup.take((wakeAt - now) * portTICK_PERIOD_MS);
+
+				broadcastDue();
 			}
 		}
+
+		/**
+		 * Start broadcast job
+		 *
+		 * @return Time of the first periodic broadcast
+		 */
+		TickType_t start() {
+			broadcastSchedule.start(broadcastPeriodMs);
+			return nextBroadcast();
+		}
+
+		/**
+		 * Broadcast knowledge when due
+		 *
+		 * @return Time of the next broadcast
+		 */
+		TickType_t step() {
+			broadcastDue();
+			return nextBroadcast();
+		}
 	};
 }
 
@@ -0,0 +1,154 @@
+/**
+ * \ingroup cdeeco
+ * @file DuplicateFilter.h
+ *
+ * Filter of recently seen knowledge fragments
+ *
+ * \date 16. 10. 2026
+ *
+ * Rebroadcasting floods the same fragments through the network, thus a node receives each fragment many times. The
+ * filter remembers a fixed number of recently seen fragments identified by knowledge type, component id, knowledge
+ * version, offset, size and hash of the data. Knowledge changing back to a recent value gets a new version, thus it is
+ * not filtered. A fragment matching a remembered one is reported as duplicate until the remembered
+ * record expires. Records are not refreshed by duplicates, so unchanged knowledge broadcasted periodically still
+ * passes the filter once per timeout.
+ */
+
+#ifndef DUPLICATE_FILTER_H
+#define DUPLICATE_FILTER_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <array>
+#include <algorithm>
+
+#include "KnowledgeFragment.h"
+#include "wrappers/FreeRTOSMutex.h"
+
+namespace CDEECO {
+	/**
+	 * Recently seen fragment filter
+	 *
+	 * @tparam SIZE Number of remembered fragments
+	 *
+	 * \ingroup cdeeco
+	 */
+	template<size_t SIZE>
+	class DuplicateFilter {
+	public:
+		/// Default time for which the fragment is remembered
+		static const uint32_t DEFAULT_TIMEOUT_MS = 5000;
+
+		/**
+		 * Duplicate filter constructor
+		 *
+		 * @param timeoutMs Time for which the fragment is remembered, 0 disables the filter
+		 */
+		DuplicateFilter(const uint32_t timeoutMs = DEFAULT_TIMEOUT_MS) :
+				timeout(timeoutMs / portTICK_PERIOD_MS) {
+			memset(&records, 0, sizeof(records));
+		}
+
+		/**
+		 * Check fragment and remember it
+		 *
+		 * @param fragment Knowledge fragment to check
+		 * @return True when the same fragment was seen recently
+		 */
+		bool isDuplicate(const KnowledgeFragment &fragment) {
+			if(timeout == 0)
+				return false;
+
+			const uint32_t hash = hashFragment(fragment);
+			const TickType_t now = xTaskGetTickCount();
+
+			recordsMutex.lock();
+			for(const Record &record : records) {
+				if(record.used && now - record.seen < timeout && record.hash == hash && record.type == fragment.type
+						&& record.id == fragment.id && record.version == fragment.version
+						&& record.offset == fragment.offset && record.size == fragment.size) {
+					hits++;
+					recordsMutex.unlock();
+					return true;
+				}
+			}
+
+			// Remember fragment in place of the oldest record
+			Record &record = records[next++ % SIZE];
+			record.used = true;
+			record.seen = now;
+			record.type = fragment.type;
+			record.id = fragment.id;
+			record.version = fragment.version;
+			record.offset = fragment.offset;
+			record.size = fragment.size;
+			record.hash = hash;
+			misses++;
+			recordsMutex.unlock();
+
+			return false;
+		}
+
+		/**
+		 * Get number of fragments reported as duplicate
+		 *
+		 * @return Number of filter hits
+		 */
+		uint32_t getHits() const {
+			return hits;
+		}
+
+		/**
+		 * Get number of fragments seen for the first time
+		 *
+		 * @return Number of filter misses
+		 */
+		uint32_t getMisses() const {
+			return misses;
+		}
+
+	private:
+		/// Record of the seen fragment
+		struct Record {
+			bool used;
+			TickType_t seen;
+			Type type;
+			Id id;
+			Version version;
+			uint32_t offset;
+			uint32_t size;
+			uint32_t hash;
+		};
+
+		/// Time for which the fragment is remembered in ticks
+		const TickType_t timeout;
+		/// Remembered fragments
+		std::array<Record, SIZE> records;
+		/// Position of the next record to replace
+		size_t next = 0;
+		/// Number of duplicates
+		uint32_t hits = 0;
+		/// Number of first seen fragments
+		uint32_t misses = 0;
+		/// Mutex for records access protection
+		FreeRTOSMutex recordsMutex;
+
+		/**
+		 * Compute hash of the fragment data
+		 *
+		 * Delta fragments with the same data applied on different base are different fragments, thus the base is
+		 * hashed as well.
+		 *
+		 * @param fragment Knowledge fragment
+		 * @return Hash of the fragment data
+		 */
+		static uint32_t hashFragment(const KnowledgeFragment &fragment) {
+			const uint32_t hash = hashData(fragment.data,
+					std::min<size_t>(fragment.size, KnowledgeFragment::MAX_DATA_SIZE));
+			return fragment.delta ? hashData(&fragment.base, sizeof(fragment.base), hash) : hash;
+		}
+	};
+}
+
+#endif // DUPLICATE_FILTER_H
@@ -15,6 +15,9 @@
 
 #include "Component.h"
 #include "KnowledgeCache.h"
+#include "PeriodicSchedule.h"
+#include "Activity.h"
+#include "StackSizes.h"
 #include "wrappers/FreeRTOSTask.h"
 
 namespace CDEECO {
@@ -30,7 +33,7 @@ namespace CDEECO {
 	 */
 	template<typename COORD_KNOWLEDGE, typename COORD_OUT_KNOWLEDGE, typename MEMBER_KNOWLEDGE,
 			typename MEMBER_OUT_KNOWLEDGE>
-	class Ensemble: FreeRTOSTask {
+	class Ensemble: Activity {
 	public:
 		/**
 		 * Ensemble constructor to be used on the node hosting coordinator
@@ -42,8 +45,10 @@ namespace CDEECO {
 		 */
 		Ensemble(Component<COORD_KNOWLEDGE> *coordinator, COORD_OUT_KNOWLEDGE *coordOutKnowledge,
 				KnowledgeLibrary<MEMBER_KNOWLEDGE> *memberLibrary, long period) :
-				period(period), coordinator(coordinator), member(NULL), coordOutKnowledge(coordOutKnowledge), memberOutKnowledge(
-				NULL), memberLibrary(memberLibrary), coordLibrary(NULL) {
+				Activity(CDEECO_ENSEMBLE_STACK, FreeRTOSTask::DEFAULT_PRIORITY, "Ensemble"), schedule(period), coordinator(coordinator), member(NULL), coordOutKnowledge(coordOutKnowledge), memberOutKnowledge(
+				NULL), memberLibrary(memberLibrary), coordLibrary(NULL), exchanged(false), lastRevision(0), lastLocalVersion(
+				0) {
+			setSchedule(schedule);
 		}
 
 		/**
@@ -56,14 +61,40 @@ namespace CDEECO {
 		 */
 		Ensemble(Component<MEMBER_KNOWLEDGE> *member, MEMBER_OUT_KNOWLEDGE *memberOutKnowledge,
 				KnowledgeLibrary<COORD_KNOWLEDGE> *coordLibrary, long period) :
-				period(period), coordinator(NULL), member(member), coordOutKnowledge(NULL), memberOutKnowledge(
-						memberOutKnowledge), memberLibrary(NULL), coordLibrary(coordLibrary) {
+				Activity(CDEECO_ENSEMBLE_STACK, FreeRTOSTask::DEFAULT_PRIORITY, "Ensemble"), schedule(period), coordinator(NULL), member(member), coordOutKnowledge(NULL), memberOutKnowledge(
+						memberOutKnowledge), memberLibrary(NULL), coordLibrary(coordLibrary), exchanged(false), lastRevision(
+						0), lastLocalVersion(0) {
+			setSchedule(schedule);
+		}
+
+		/**
+		 * Skip records that have not changed since the last exchange
+		 *
+		 * Records are skipped only when the local component knowledge has not changed either, the changes made by the
+		 * exchange itself included. Disabled by default.
+		 *
+		 * @param skip Whenever to skip unchanged records
+		 */
+		void setSkipUnchanged(const bool skip) {
+			skipUnchanged = skip;
+		}
+
+		/**
+		 * Get timing statistics
+		 *
+		 * @return Activation jitter, execution time and overruns of the knowledge exchange
+		 */
+		TimingStats getTimingStats() {
+			return schedule.getStats();
 		}
 
 	protected:
 		/**
 		 * Membership to function to be implemented
 		 *
+		 * To be implemented by user defined ensemble. Ensembles derived from SnapshotEnsemble implement
+		 * isMemberSnapshot instead.
+		 *
 		 * @param coordKnowledge Coordinator knowledge
 		 * @param coordId Id of the coordinator
 		 * @param memberKnowledge Member knowledge
@@ -76,6 +107,9 @@ namespace CDEECO {
 		/**
 		 * Member to Coordinator knowledge map function to be implemented
 		 *
+		 * To be implemented by user defined ensemble. Ensembles derived from SnapshotEnsemble implement
+		 * memberToCoordMapSnapshot instead.
+		 *
 		 * @param coordKnowledge Coordinator knowledge
 		 * @param memberId Id of the member
 		 * @param memberKnowledge Member knowledge
@@ -87,6 +121,9 @@ namespace CDEECO {
 		/**
 		 * Coordinator to member knowledge map function to be implemented
 		 *
+		 * To be implemented by user defined ensemble. Ensembles derived from SnapshotEnsemble implement
+		 * coordToMemberMapSnapshot instead.
+		 *
 		 * @param memberKnowledge Member knowledge
 		 * @param coordId Id of the coordinator
 		 * @param coordKnowledge Coordinator knowledge
@@ -95,9 +132,80 @@ namespace CDEECO {
 		virtual MEMBER_OUT_KNOWLEDGE coordToMemberMap(const MEMBER_KNOWLEDGE memberKnowledge, const Id coordId,
 				const COORD_KNOWLEDGE coordKnowledge) = 0;
 
+		/**
+		 * Membership function working with knowledge snapshots
+		 *
+		 * Called by the framework with references to the knowledge snapshots held by the ensemble. The default
+		 * implementation passes copies of the snapshots to isMember. To be implemented by ensembles derived from
+		 * SnapshotEnsemble.
+		 *
+		 * @param coordId Id of the coordinator
+		 * @param coordKnowledge Coordinator knowledge snapshot
+		 * @param memberId Id of the member
+		 * @param memberKnowledge Member knowledge snapshot
+		 * @return Whenever the member is part of Ensemble
+		 */
+		virtual bool isMemberSnapshot(const Id coordId, const COORD_KNOWLEDGE &coordKnowledge, const Id memberId,
+				const MEMBER_KNOWLEDGE &memberKnowledge) {
+			return isMember(coordId, coordKnowledge, memberId, memberKnowledge);
+		}
+
+		/**
+		 * Member to Coordinator knowledge map function working with knowledge snapshots
+		 *
+		 * The default implementation passes copies of the snapshots to memberToCoordMap. To be implemented by
+		 * ensembles derived from SnapshotEnsemble.
+		 *
+		 * @param coordKnowledge Coordinator knowledge snapshot
+		 * @param memberId Id of the member
+		 * @param memberKnowledge Member knowledge snapshot
+		 * @return Output knowledge for coordinator
+		 */
+		virtual COORD_OUT_KNOWLEDGE memberToCoordMapSnapshot(const COORD_KNOWLEDGE &coordKnowledge, const Id memberId,
+				const MEMBER_KNOWLEDGE &memberKnowledge) {
+			return memberToCoordMap(coordKnowledge, memberId, memberKnowledge);
+		}
+
+		/**
+		 * Coordinator to member knowledge map function working with knowledge snapshots
+		 *
+		 * The default implementation passes copies of the snapshots to coordToMemberMap. To be implemented by
+		 * ensembles derived from SnapshotEnsemble.
+		 *
+		 * @param memberKnowledge Member knowledge snapshot
+		 * @param coordId Id of the coordinator
+		 * @param coordKnowledge Coordinator knowledge snapshot
+		 * @return Output knowledge for member
+		 */
+		virtual MEMBER_OUT_KNOWLEDGE coordToMemberMapSnapshot(const MEMBER_KNOWLEDGE &memberKnowledge, const Id coordId,
+				const COORD_KNOWLEDGE &coordKnowledge) {
+			return coordToMemberMap(memberKnowledge, coordId, coordKnowledge);
+		}
+
+		/**
+		 * Try to run knowledge exchange
+		 *
+		 * Executed periodically by the ensemble task.
+		 */
+		void runExchange() {
+			if(coordinator != NULL && memberLibrary != NULL && member == NULL && coordLibrary == NULL) {
+				runMemberToCoordExchange<COORD_OUT_KNOWLEDGE>();
+				return;
+			}
+
+			if(coordinator == NULL && memberLibrary == NULL && member != NULL && coordLibrary != NULL) {
+				runCoordToMemberExchange<MEMBER_OUT_KNOWLEDGE>();
+				return;
+			}
+
+			// Error mixed setup
+			console.print(Error, "Error mixed ensemble setup");
+			assert_param(false);
+		}
+
 	private:
-		/// INterval between mapping tries
-		long period;
+		/// Schedule of mapping tries
+		PeriodicSchedule schedule;
 		/// Pointer to coordinator component
 		Component<COORD_KNOWLEDGE> *coordinator;
 		/// Pointer to member component
@@ -110,40 +218,54 @@ namespace CDEECO {
 		KnowledgeLibrary<MEMBER_KNOWLEDGE> *memberLibrary;
 		/// Pointer to coordinator library
 		KnowledgeLibrary<COORD_KNOWLEDGE> *coordLibrary;
+		/// Whenever to skip records that have not changed since the last exchange
+		bool skipUnchanged = false;
+		/// Whenever the exchange has already run
+		bool exchanged;
+		/// Library revision at the start of the last exchange
+		uint32_t lastRevision;
+		/// Local component knowledge version at the start of the last exchange
+		Version lastLocalVersion;
+		/// Snapshot of the coordinator knowledge the exchange runs with
+		COORD_KNOWLEDGE coordSnapshot;
+		/// Snapshot of the member knowledge the exchange runs with
+		MEMBER_KNOWLEDGE memberSnapshot;
 
 		/** Ensemble periodic task */
 		void run() {
 			// Schedule the task periodically
+			schedule.start();
 			while(1) {
-				// For all knowledge from the cache check member and execute map
-				console.print(Debug, ">>>> Ensemble task running now\n");
-
-				runExchange();
-
 				// Wait for next execution time
-				vTaskDelay(period / portTICK_PERIOD_MS);
+				schedule.waitRelease();
+
+				step();
 			}
 		}
 
 		/**
-		 * Try to run knowledge exchange
+		 * Start periodic job
 		 *
-		 * Executed periodically.
+		 * @return Time of the first exchange
 		 */
-		void runExchange() {
-			if(coordinator != NULL && memberLibrary != NULL && member == NULL && coordLibrary == NULL) {
-				runMemberToCoordExchange<COORD_OUT_KNOWLEDGE>();
-				return;
-			}
+		TickType_t start() {
+			schedule.start();
+			return schedule.getRelease();
+		}
 
-			if(coordinator == NULL && memberLibrary == NULL && member != NULL && coordLibrary != NULL) {
-				runCoordToMemberExchange<MEMBER_OUT_KNOWLEDGE>();
-				return;
-			}
+		/**
+		 * Run the exchange once
+		 *
+		 * @return Time of the next exchange
+		 */
+		TickType_t step() {
+			// For all knowledge from the cache check member and execute map
+			console.print(Debug, ">>>> Ensemble task running now\n");
 
-			// Error mixed setup
-			console.print(Error, "Error mixed ensemble setup");
-			assert_param(false);
+			schedule.activated();
+			runExchange();
+			schedule.completed();
+			return schedule.getRelease();
 		}
 
 		/**
@@ -154,15 +276,25 @@ namespace CDEECO {
 		template<typename T>
 		typename std::enable_if<!std::is_void<T>::value, void>::type runMemberToCoordExchange() {
 			console.print(Debug, ">>>> Trying member->coord exchange\n");
-			for(const auto &record : *memberLibrary) {
-				if(record.complete) {
+
+			// With skipping enabled, unchanged records need to be processed only if the coordinator changed
+			const uint32_t revision = memberLibrary->getRevision();
+			const Version localVersion = coordinator->getVersion();
+			const bool coordChanged = !skipUnchanged || !exchanged || localVersion != lastLocalVersion;
+
+			for(auto it = memberLibrary->begin(); it != memberLibrary->end(); ++it) {
+				if(!coordChanged && !it.changedSince(lastRevision))
+					continue;
+
+				Id memberId;
+				if(it.readComplete(memberId, memberSnapshot)) {
 					console.print(Debug, ">>>> Found complete record, trying membership <<<<\n");
-					COORD_KNOWLEDGE coordKnowledge = coordinator->lockReadKnowledge();
-					if(isMember(coordinator->getId(), coordKnowledge, record.id, record.knowledge)) {
+					coordinator->lockReadKnowledge(coordSnapshot, coordinator->knowledge);
+					if(isMemberSnapshot(coordinator->getId(), coordSnapshot, memberId, memberSnapshot)) {
 						console.print(Debug,
 								">>>> Record is member of this Ensemble, running member->coord exchange\n");
 
-						COORD_OUT_KNOWLEDGE out = memberToCoordMap(coordKnowledge, record.id, record.knowledge);
+						COORD_OUT_KNOWLEDGE out = memberToCoordMapSnapshot(coordSnapshot, memberId, memberSnapshot);
 
 						coordinator->lockWriteKnowledge(*coordOutKnowledge, out);
 					} else {
@@ -170,6 +302,11 @@ namespace CDEECO {
 					}
 				}
 			}
+
+			// Remember state for the next exchange
+			exchanged = true;
+			lastRevision = revision;
+			lastLocalVersion = localVersion;
 		}
 		/**
 		 * Map from member to coordinator
@@ -189,14 +326,24 @@ namespace CDEECO {
 		template<typename T>
 		typename std::enable_if<!std::is_void<T>::value, void>::type runCoordToMemberExchange() {
 			console.print(Debug, ">>>> Trying coord->member exchange\n");
-			for(const auto &record : *coordLibrary) {
-				if(record.complete) {
+
+			// With skipping enabled, unchanged records need to be processed only if the member changed
+			const uint32_t revision = coordLibrary->getRevision();
+			const Version localVersion = member->getVersion();
+			const bool memberChanged = !skipUnchanged || !exchanged || localVersion != lastLocalVersion;
+
+			for(auto it = coordLibrary->begin(); it != coordLibrary->end(); ++it) {
+				if(!memberChanged && !it.changedSince(lastRevision))
+					continue;
+
+				Id coordId;
+				if(it.readComplete(coordId, coordSnapshot)) {
 					console.print(Debug, ">>>> Found complete record, trying membership <<<<\n");
-					MEMBER_KNOWLEDGE memberKnowledge = member->lockReadKnowledge();
-					if(isMember(record.id, record.knowledge, member->getId(), memberKnowledge)) {
+					member->lockReadKnowledge(memberSnapshot, member->knowledge);
+					if(isMemberSnapshot(coordId, coordSnapshot, member->getId(), memberSnapshot)) {
 						console.print(Debug, ">>>> Record is member of this Ensable, running coord->member exchange");
 
-						MEMBER_OUT_KNOWLEDGE out = coordToMemberMap(memberKnowledge, record.id, record.knowledge);
+						MEMBER_OUT_KNOWLEDGE out = coordToMemberMapSnapshot(memberSnapshot, coordId, coordSnapshot);
 
 						member->lockWriteKnowledge(*memberOutKnowledge, out);
 
@@ -205,6 +352,11 @@ namespace CDEECO {
 					}
 				}
 			}
+
+			// Remember state for the next exchange
+			exchanged = true;
+			lastRevision = revision;
+			lastLocalVersion = localVersion;
 		}
 		/**
 		 *  Map from coordinator to member
@@ -216,6 +368,80 @@ namespace CDEECO {
 			// MEMBER_OUT_KNOWLEDGE is void
 		}
 	};
+
+	/**
+	 * Ensemble implemented by the snapshot methods
+	 *
+	 * The user ensemble implements isMemberSnapshot, memberToCoordMapSnapshot and coordToMemberMapSnapshot instead of
+	 * the functions taking knowledge copies. The snapshots are passed by reference, thus the knowledge is neither
+	 * copied on each call nor placed on the ensemble stack.
+	 *
+	 * @tparam COORD_KNOWLEDGE Type of coordinator knowledge
+	 * @tparam COORD_OUT_KNOWLEDGE Type of coordinator output knowledge
+	 * @tparam MEMEBR_KNOWLEDGE Type of member knowledge
+	 * @tparam MEMBER_KNOWLEDGE Type of member output knowledge
+	 *
+	 * \ingroup cdeeco
+	 */
+	template<typename COORD_KNOWLEDGE, typename COORD_OUT_KNOWLEDGE, typename MEMBER_KNOWLEDGE,
+			typename MEMBER_OUT_KNOWLEDGE>
+	class SnapshotEnsemble: public Ensemble<COORD_KNOWLEDGE, COORD_OUT_KNOWLEDGE, MEMBER_KNOWLEDGE, MEMBER_OUT_KNOWLEDGE> {
+	public:
+		using Ensemble<COORD_KNOWLEDGE, COORD_OUT_KNOWLEDGE, MEMBER_KNOWLEDGE, MEMBER_OUT_KNOWLEDGE>::Ensemble;
+
+	protected:
+		/**
+		 * Membership function working with knowledge snapshots
+		 *
+		 * @param coordId Id of the coordinator
+		 * @param coordKnowledge Coordinator knowledge snapshot
+		 * @param memberId Id of the member
+		 * @param memberKnowledge Member knowledge snapshot
+		 * @return Whenever the member is part of Ensemble
+		 */
+		virtual bool isMemberSnapshot(const Id coordId, const COORD_KNOWLEDGE &coordKnowledge, const Id memberId,
+				const MEMBER_KNOWLEDGE &memberKnowledge) = 0;
+
+		/**
+		 * Member to Coordinator knowledge map function working with knowledge snapshots
+		 *
+		 * @param coordKnowledge Coordinator knowledge snapshot
+		 * @param memberId Id of the member
+		 * @param memberKnowledge Member knowledge snapshot
+		 * @return Output knowledge for coordinator
+		 */
+		virtual COORD_OUT_KNOWLEDGE memberToCoordMapSnapshot(const COORD_KNOWLEDGE &coordKnowledge, const Id memberId,
+				const MEMBER_KNOWLEDGE &memberKnowledge) = 0;
+
+		/**
+		 * Coordinator to member knowledge map function working with knowledge snapshots
+		 *
+		 * @param memberKnowledge Member knowledge snapshot
+		 * @param coordId Id of the coordinator
+		 * @param coordKnowledge Coordinator knowledge snapshot
+		 * @return Output knowledge for member
+		 */
+		virtual MEMBER_OUT_KNOWLEDGE coordToMemberMapSnapshot(const MEMBER_KNOWLEDGE &memberKnowledge, const Id coordId,
+				const COORD_KNOWLEDGE &coordKnowledge) = 0;
+
+		/** Pass the knowledge copies to the snapshot membership function */
+		bool isMember(const Id coordId, const COORD_KNOWLEDGE coordKnowledge, const Id memberId,
+				const MEMBER_KNOWLEDGE memberKnowledge) {
+			return isMemberSnapshot(coordId, coordKnowledge, memberId, memberKnowledge);
+		}
+
+		/** Pass the knowledge copies to the snapshot member to coordinator map function */
+		COORD_OUT_KNOWLEDGE memberToCoordMap(const COORD_KNOWLEDGE coordKnowledge, const Id memberId,
+				const MEMBER_KNOWLEDGE memberKnowledge) {
+			return memberToCoordMapSnapshot(coordKnowledge, memberId, memberKnowledge);
+		}
+
+		/** Pass the knowledge copies to the snapshot coordinator to member map function */
+		MEMBER_OUT_KNOWLEDGE coordToMemberMap(const MEMBER_KNOWLEDGE memberKnowledge, const Id coordId,
+				const COORD_KNOWLEDGE coordKnowledge) {
+			return coordToMemberMapSnapshot(memberKnowledge, coordId, coordKnowledge);
+		}
+	};
 }
 
 #endif // ENSEMBLE_H
@@ -0,0 +1,247 @@
+/**
+ * \ingroup cdeeco
+ * @file Executor.cpp
+ *
+ * Shared executor implementation
+ *
+ * \date 16. 10. 2026
+ */
+
+#include "Executor.h"
+
+namespace CDEECO {
+	Executor *Executor::defaultExecutor = NULL;
+
+	Executor::Executor(const size_t workers, const size_t stack) :
+			signal(workers, 0), wheelTime(xTaskGetTickCount()) {
+		assert_param(workers > 0);
+		for(size_t i = 0; i < workers; ++i)
+			new Worker(*this, stack);
+	}
+
+	void Executor::setDefault(Executor *executor) {
+		defaultExecutor = executor;
+	}
+
+	Executor *Executor::getDefault() {
+		return defaultExecutor;
+	}
+
+	void Executor::add(Job &job) {
+		mutex.lock();
+		if(job.priority > maxPriority)
+			maxPriority = job.priority;
+		makeReady(job);
+		mutex.unlock();
+	}
+
+	bool Executor::trigger(Job &job) {
+		mutex.lock();
+		bool triggered = true;
+		switch(job.state) {
+		case Job::State::Idle:
+			makeReady(job);
+			break;
+		case Job::State::Timed:
+			removeTimed(job);
+			makeReady(job);
+			break;
+		case Job::State::Ready:
+			triggered = false;
+			break;
+		case Job::State::Running:
+			triggered = !job.again;
+			job.again = true;
+			break;
+		}
+		mutex.unlock();
+		return triggered;
+	}
+
+	void Executor::setPriority(Job &job, const unsigned long priority) {
+		mutex.lock();
+		if(priority > maxPriority)
+			maxPriority = priority;
+		if(job.state == Job::State::Ready) {
+			removeReady(job);
+			job.priority = priority;
+			makeReady(job);
+		} else {
+			job.priority = priority;
+		}
+		mutex.unlock();
+	}
+
+	void Executor::work(Worker &worker) {
+		unsigned long priority = FreeRTOSTask::DEFAULT_PRIORITY;
+
+		mutex.lock();
+		while(true) {
+			const TickType_t now = xTaskGetTickCount();
+			advance(now);
+
+			// Wait for ready job or next timer
+			if(ready == NULL) {
+				TickType_t due;
+				const bool timed = nextDue(now, due);
+				mutex.unlock();
+				if(timed)
+					signal.take((due - now) * portTICK_PERIOD_MS);
+				else
+					signal.take();
+				mutex.lock();
+				continue;
+			}
+
+			Job &job = *ready;
+			ready = job.next;
+			job.next = NULL;
+			job.state = Job::State::Running;
+			mutex.unlock();
+
+			// Run the job at its priority
+			if(job.priority != priority) {
+				priority = job.priority;
+				worker.setPriority(priority);
+			}
+			TickType_t due;
+			if(job.started) {
+				due = job.step();
+			} else {
+				job.started = true;
+				due = job.start();
+			}
+
+			// Idle workers run at the highest priority, thus they pick ready jobs without delay
+			mutex.lock();
+			if(priority != maxPriority) {
+				priority = maxPriority;
+				worker.setPriority(priority);
+			}
+
+			if(job.again) {
+				job.again = false;
+				makeReady(job);
+			} else if(job.timed) {
+				makeTimed(job, due);
+			} else {
+				job.state = Job::State::Idle;
+			}
+		}
+	}
+
+	void Executor::makeReady(Job &job) {
+		job.state = Job::State::Ready;
+
+		// Insert behind the jobs of the same or higher priority
+		Job **position = &ready;
+		while(*position != NULL && (*position)->priority >= job.priority)
+			position = &(*position)->next;
+		job.next = *position;
+		*position = &job;
+
+		signal.give();
+	}
+
+	void Executor::removeReady(Job &job) {
+		Job **position = &ready;
+		while(*position != &job)
+			position = &(*position)->next;
+		*position = job.next;
+		job.next = NULL;
+	}
+
+	void Executor::makeTimed(Job &job, const TickType_t due) {
+		if((int32_t) (due - xTaskGetTickCount()) <= 0) {
+			makeReady(job);
+			return;
+		}
+
+		job.state = Job::State::Timed;
+		job.due = due;
+		const size_t slot = due % WHEEL_SLOTS;
+		job.next = wheel[slot];
+		wheel[slot] = &job;
+		occupied[slot / WORD_SLOTS] |= 1UL << (slot % WORD_SLOTS);
+
+		// The earliest due time stays known when the job is not before it
+		if(timedJobs++ == 0 || (earliestKnown && (int32_t) (due - earliest) < 0)) {
+			earliest = due;
+			earliestKnown = true;
+		}
+	}
+
+	void Executor::removeTimed(Job &job) {
+		const size_t slot = job.due % WHEEL_SLOTS;
+		Job **position = &wheel[slot];
+		while(*position != &job)
+			position = &(*position)->next;
+		unlinkTimed(position, slot);
+	}
+
+	void Executor::unlinkTimed(Job **position, const size_t slot) {
+		Job &job = **position;
+		*position = job.next;
+		job.next = NULL;
+		if(wheel[slot] == NULL)
+			occupied[slot / WORD_SLOTS] &= ~(1UL << (slot % WORD_SLOTS));
+		--timedJobs;
+		if(job.due == earliest)
+			earliestKnown = false;
+	}
+
+	void Executor::advance(const TickType_t now) {
+		// Check each slot passed since the last advance, but each slot once at most
+		const TickType_t passed = now - wheelTime;
+		const TickType_t slots = passed < WHEEL_SLOTS ? passed : WHEEL_SLOTS;
+		for(TickType_t i = 1; i <= slots; ++i) {
+			const size_t slot = (wheelTime + i) % WHEEL_SLOTS;
+			Job **position = &wheel[slot];
+			while(*position != NULL) {
+				Job &job = **position;
+				if((int32_t) (job.due - now) <= 0) {
+					unlinkTimed(position, slot);
+					makeReady(job);
+				} else {
+					position = &job.next;
+				}
+			}
+		}
+		wheelTime = now;
+	}
+
+	bool Executor::nextDue(const TickType_t now, TickType_t &due) {
+		if(timedJobs == 0)
+			return false;
+
+		// Visit occupied slots in the order of their due times, the first job due in the current rotation is the
+		// earliest one, otherwise it is the earliest job of the later rotations
+		if(!earliestKnown) {
+			bool found = false;
+			for(TickType_t distance = 1; distance <= WHEEL_SLOTS;) {
+				size_t slot = (now + distance) % WHEEL_SLOTS;
+				const uint32_t bits = occupied[slot / WORD_SLOTS] >> (slot % WORD_SLOTS);
+				if(bits == 0) {
+					distance += WORD_SLOTS - slot % WORD_SLOTS;
+					continue;
+				}
+				distance += __builtin_ctzl(bits);
+				if(distance > WHEEL_SLOTS)
+					break;
+				slot = (now + distance) % WHEEL_SLOTS;
+				for(Job *job = wheel[slot]; job != NULL; job = job->next)
+					if(!found || job->due - now < earliest - now) {
+						earliest = job->due;
+						found = true;
+					}
+				if(earliest - now == distance)
+					break;
+				++distance;
+			}
+			earliestKnown = true;
+		}
+
+		due = earliest;
+		return true;
+	}
+}
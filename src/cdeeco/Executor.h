@@ -0,0 +1,316 @@
+/**
+ * \ingroup cdeeco
+ * @file Executor.h
+ *
+ * Shared executor running framework activities as jobs on a pool of worker tasks
+ *
+ * \date 16. 10. 2026
+ *
+ * By default each task, ensemble and component runs in its own FreeRTOS task with its own stack, although most of
+ * the time it just waits. The executor runs these activities as jobs on a small pool of workers instead. Jobs waiting
+ * for time are kept in a timer wheel, jobs ready to run are kept in a queue ordered by priority. Each worker runs
+ * the ready job of the highest priority at the priority of the job. Idle workers advance the timer wheel, thus the
+ * executor needs no extra task.
+ *
+ * The executor is used by the activities created after it is installed by Executor::setDefault. The worker stacks
+ * have to fit the largest job stack, the StackMonitor reports the worker stack usage.
+ *
+ * Example:
+ * @code
+ * CDEECO::Executor::setDefault(new CDEECO::Executor(2, 2048));
+ * cdeecoSetup(uniqId);
+ * @endcode
+ */
+
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "main.h"
+#include "StackSizes.h"
+#include "wrappers/FreeRTOSTask.h"
+#include "wrappers/FreeRTOSMutex.h"
+#include "wrappers/FreeRTOSSemaphore.h"
+
+namespace CDEECO {
+	class Executor;
+
+	/**
+	 * Job run by the executor
+	 *
+	 * The job is never run concurrently with itself.
+	 *
+	 * \ingroup cdeeco
+	 */
+	class Job {
+	public:
+		/**
+		 * Create job
+		 *
+		 * @param priority Job priority, relative to tskIDLE_PRIORITY as the FreeRTOSTask priorities
+		 * @param timed Whenever the steps are due at the returned time, false for the jobs waiting for trigger only
+		 */
+		Job(const unsigned long priority, const bool timed = true) :
+				priority(priority), timed(timed) {
+		}
+
+		/**
+		 * Get job priority
+		 *
+		 * @return Job priority
+		 */
+		unsigned long getPriority() const {
+			return priority;
+		}
+
+		/**
+		 * Start the job
+		 *
+		 * Called once, before the first step.
+		 *
+		 * @return Due time of the first step, ignored when the job is not timed
+		 */
+		virtual TickType_t start() = 0;
+
+		/**
+		 * Run single job step
+		 *
+		 * @return Due time of the next step, ignored when the job is not timed
+		 */
+		virtual TickType_t step() = 0;
+
+	protected:
+		/// Job priority
+		unsigned long priority;
+		/// Whenever the steps are due at the returned time
+		const bool timed;
+
+	private:
+		friend class Executor;
+
+		/// Job state in the executor
+		enum class State : uint8_t {
+			/// Waiting for trigger
+			Idle,
+			/// Waiting in the timer wheel
+			Timed,
+			/// Waiting in the ready queue
+			Ready,
+			/// Running on a worker
+			Running
+		};
+
+		/// Next job in the ready queue or in the timer wheel slot
+		Job *next = NULL;
+		/// Due time in the timer wheel
+		TickType_t due = 0;
+		/// Job state
+		State state = State::Idle;
+		/// Whenever start was called
+		bool started = false;
+		/// Whenever the job was triggered while running
+		bool again = false;
+	};
+
+	/**
+	 * Executor running jobs on a pool of worker tasks
+	 *
+	 * \ingroup cdeeco
+	 */
+	class Executor {
+	public:
+		/// Number of timer wheel slots, each slot covers one tick
+		static const size_t WHEEL_SLOTS = 256;
+		/// Number of timer wheel slots per occupancy word
+		static const size_t WORD_SLOTS = 32;
+
+		/**
+		 * Create executor
+		 *
+		 * @param workers Number of worker tasks
+		 * @param stack Stack size of each worker task in words
+		 */
+		Executor(const size_t workers, const size_t stack = CDEECO_WORKER_STACK);
+
+		/**
+		 * Set executor of the activities created from now on
+		 *
+		 * @param executor Executor to use, NULL to run activities in their own tasks
+		 */
+		static void setDefault(Executor *executor);
+
+		/**
+		 * Get executor of the newly created activities
+		 *
+		 * @return Executor or NULL when activities run in their own tasks
+		 */
+		static Executor *getDefault();
+
+		/**
+		 * Add job
+		 *
+		 * The job is started as soon as possible.
+		 *
+		 * @param job Job to add
+		 */
+		void add(Job &job);
+
+		/**
+		 * Trigger job step
+		 *
+		 * The step is run as soon as possible, regardless of the due time returned by the previous step. Triggers
+		 * coming while the step is pending are coalesced.
+		 *
+		 * @param job Job to trigger
+		 * @return Whenever the trigger caused new step, false when it was coalesced with the pending one
+		 */
+		bool trigger(Job &job);
+
+		/**
+		 * Change job priority
+		 *
+		 * A job waiting in the ready queue is moved to the position of its new priority.
+		 *
+		 * @param job Job to modify
+		 * @param priority New job priority
+		 */
+		void setPriority(Job &job, const unsigned long priority);
+
+	private:
+		/**
+		 * Worker task
+		 */
+		class Worker: FreeRTOSTask {
+		public:
+			/**
+			 * Create worker
+			 *
+			 * @param executor Executor to run the jobs of
+			 * @param stack Stack size in words
+			 */
+			Worker(Executor &executor, const size_t stack) :
+					FreeRTOSTask(stack, FreeRTOSTask::DEFAULT_PRIORITY, "Worker"), executor(executor) {
+			}
+
+			using FreeRTOSTask::setPriority;
+
+		private:
+			/// Executor to run the jobs of
+			Executor &executor;
+
+			void run() {
+				executor.work(*this);
+			}
+		};
+
+		/// Executor of the newly created activities
+		static Executor *defaultExecutor;
+
+		/// Lock of the ready queue and the timer wheel
+		FreeRTOSMutex mutex;
+		/// Wakes idle workers when a job gets ready
+		FreeRTOSSemaphore signal;
+		/// Ready jobs ordered by priority, jobs of the same priority in the order they got ready
+		Job *ready = NULL;
+		/// Timer wheel, jobs are kept in the slot of their due time
+		Job *wheel[WHEEL_SLOTS] = { };
+		/// Timer wheel slots holding jobs, one bit per slot
+		uint32_t occupied[WHEEL_SLOTS / WORD_SLOTS] = { };
+		/// Number of jobs in the timer wheel
+		size_t timedJobs = 0;
+		/// Due time of the first job in the timer wheel, valid when earliestKnown is set
+		TickType_t earliest = 0;
+		/// Whenever the earliest due time is up to date
+		bool earliestKnown = false;
+		/// Time the timer wheel was advanced to
+		TickType_t wheelTime;
+		/// Highest priority of the added jobs, priority of idle workers
+		unsigned long maxPriority = FreeRTOSTask::DEFAULT_PRIORITY;
+
+		/**
+		 * Worker body
+		 *
+		 * Runs ready jobs, advances the timer wheel when there is none. Idle workers sleep until the earliest timed job
+		 * is due, or until a job is triggered when the timer wheel is empty.
+		 *
+		 * @param worker Worker running the body
+		 */
+		void work(Worker &worker);
+
+		/**
+		 * Put job to the ready queue
+		 *
+		 * Has to be called with the executor locked.
+		 *
+		 * @param job Job to put
+		 */
+		void makeReady(Job &job);
+
+		/**
+		 * Remove job from the ready queue
+		 *
+		 * Has to be called with the executor locked.
+		 *
+		 * @param job Job to remove
+		 */
+		void removeReady(Job &job);
+
+		/**
+		 * Put job to the timer wheel
+		 *
+		 * Has to be called with the executor locked. Jobs due already are put to the ready queue.
+		 *
+		 * @param job Job to put
+		 * @param due Due time
+		 */
+		void makeTimed(Job &job, const TickType_t due);
+
+		/**
+		 * Remove job from the timer wheel
+		 *
+		 * Has to be called with the executor locked.
+		 *
+		 * @param job Job to remove
+		 */
+		void removeTimed(Job &job);
+
+		/**
+		 * Unlink job from the timer wheel slot
+		 *
+		 * Has to be called with the executor locked.
+		 *
+		 * @param position Link to the job in the slot
+		 * @param slot Slot holding the job
+		 */
+		void unlinkTimed(Job **position, const size_t slot);
+
+		/**
+		 * Move jobs due from the timer wheel to the ready queue
+		 *
+		 * Has to be called with the executor locked.
+		 *
+		 * @param now Current time
+		 */
+		void advance(const TickType_t now);
+
+		/**
+		 * Get time of the next timer wheel check
+		 *
+		 * Has to be called with the executor locked, right after advancing the timer wheel to the current time. The
+		 * earliest due time is kept until the first job leaves the wheel, then the occupied slots are searched for
+		 * the next one.
+		 *
+		 * @param now Current time
+		 * @param due Due time of the first job in the wheel
+		 * @return Whenever there is a job in the wheel
+		 */
+		bool nextDue(const TickType_t now, TickType_t &due);
+	};
+}
+
+#endif // EXECUTOR_H
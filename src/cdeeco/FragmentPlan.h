@@ -0,0 +1,186 @@
+/**
+ * \ingroup cdeeco
+ * @file FragmentPlan.h
+ *
+ * Compile-time plan of splitting knowledge into fragments
+ *
+ * \date 16. 10. 2026
+ *
+ * The knowledge is split into consecutive fragments, each starting at an offset allowed by the KnowledgeTrait and
+ * holding at most FragmentPlan::CAPACITY bytes. Fragments are as long as possible. When the trait defines no offsets
+ * the fragments start at field or array element boundaries given by KnowledgeFields. Fields and elements larger than
+ * a fragment, as well as knowledge without fields, are split at the maximal fragment size. The plan also contains table
+ * mapping each knowledge byte to the fragment holding it, thus a knowledge change maps to its fragments without any
+ * runtime search.
+ */
+
+#ifndef FRAGMENT_PLAN_H
+#define FRAGMENT_PLAN_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Knowledge.h"
+#include "KnowledgeFields.h"
+#include "KnowledgeFragment.h"
+
+namespace CDEECO {
+	/**
+	 * Fragmentation plan of the knowledge
+	 *
+	 * @tparam KNOWLEDGE Knowledge type
+	 *
+	 * \ingroup cdeeco
+	 */
+	template<typename KNOWLEDGE>
+	class FragmentPlan {
+	public:
+		/// Knowledge size
+		static const size_t SIZE = sizeof(KNOWLEDGE);
+		/// Maximal fragment data size, fits the radio frame with any plain header of the knowledge
+		static const size_t CAPACITY = KnowledgeFragment::MAX_FRAME_PAYLOAD - KnowledgeFragment::maxHeaderLength(SIZE);
+
+		static_assert(SIZE <= UINT16_MAX, "Knowledge too large to be addressed by fragment offsets.");
+
+		/// Planned fragment
+		struct Fragment {
+			/// Fragment offset in the knowledge
+			uint16_t start;
+			/// Fragment size
+			uint16_t size;
+		};
+
+	private:
+		/**
+		 * Get next fragment start
+		 *
+		 * @param start Start of the current fragment
+		 * @return Start of the next fragment, SIZE when the current one is the last, 0 when no allowed offset fits
+		 */
+		static constexpr size_t nextStart(const size_t start) {
+			if(start + CAPACITY >= SIZE)
+				return SIZE;
+
+			const auto &offsets = KnowledgeTrait<KNOWLEDGE>::offsets;
+			if(offsets.size() == 0) {
+				// Last field or element boundary fitting the fragment
+				const auto fields = KnowledgeFields<KNOWLEDGE>::fields();
+				size_t next = 0;
+				for(size_t i = 0; i < fields.size(); ++i) {
+					for(size_t j = 0; j < fields[i].count; ++j) {
+						const size_t boundary = fields[i].offset + j * fields[i].elementSize();
+						if(boundary > start && boundary <= start + CAPACITY && boundary > next)
+							next = boundary;
+					}
+				}
+				return next != 0 ? next : start + CAPACITY;
+			}
+
+			// Last allowed offset fitting the fragment
+			size_t next = 0;
+			for(size_t i = 0; i < offsets.size(); ++i)
+				if(offsets[i] > start && offsets[i] <= start + CAPACITY)
+					next = offsets[i];
+			return next;
+		}
+
+		/**
+		 * Count planned fragments
+		 *
+		 * @return Number of fragments or 0 when the allowed offsets are too far apart
+		 */
+		static constexpr size_t countFragments() {
+			const auto &offsets = KnowledgeTrait<KNOWLEDGE>::offsets;
+			if(offsets.size() != 0 && offsets[0] != 0)
+				return 0;
+
+			size_t count = 0;
+			for(size_t start = 0; start < SIZE; count++) {
+				start = nextStart(start);
+				if(start == 0)
+					return 0;
+			}
+			return count;
+		}
+
+		/**
+		 * Check all planned fragments fit the radio frame
+		 *
+		 * @return Whenever the encoded length of each plain fragment is at most the frame payload
+		 */
+		static constexpr bool fitFrame() {
+			for(size_t start = 0; start < SIZE;) {
+				const size_t end = nextStart(start);
+				if(end == 0)
+					return true;
+				if(KnowledgeFragment::maxLength(end - start, start) > KnowledgeFragment::MAX_FRAME_PAYLOAD)
+					return false;
+				start = end;
+			}
+			return true;
+		}
+
+	public:
+		/// Number of fragments
+		static const size_t COUNT = countFragments();
+
+		static_assert(COUNT > 0, "Knowledge trait offsets have to start at 0 and be at most CAPACITY bytes apart.");
+		static_assert(COUNT <= UINT8_MAX, "Too many fragments for the lookup table.");
+		static_assert(fitFrame(), "Planned fragment does not fit the radio frame.");
+
+		/// Plan tables
+		struct Plan {
+			/// Fragments ordered by start offset
+			Fragment fragments[COUNT];
+			/// Index of the fragment holding each knowledge byte
+			uint8_t lookup[SIZE];
+		};
+
+		/// Plan instance
+		static const Plan plan;
+
+		/**
+		 * Get index of the fragment holding the knowledge byte
+		 *
+		 * @param offset Offset of the byte in the knowledge
+		 * @return Fragment index
+		 */
+		static size_t fragmentOf(const size_t offset) {
+			return plan.lookup[offset];
+		}
+
+		/**
+		 * Get planned fragment
+		 *
+		 * @param index Fragment index
+		 * @return Fragment range
+		 */
+		static const Fragment &getFragment(const size_t index) {
+			return plan.fragments[index];
+		}
+
+	private:
+		/**
+		 * Create plan tables
+		 *
+		 * @return Plan tables
+		 */
+		static constexpr Plan makePlan() {
+			Plan plan = { };
+			size_t start = 0;
+			for(size_t i = 0; i < COUNT; ++i) {
+				const size_t end = nextStart(start);
+				plan.fragments[i] = { (uint16_t) start, (uint16_t) (end - start) };
+				for(size_t j = start; j < end; ++j)
+					plan.lookup[j] = i;
+				start = end;
+			}
+			return plan;
+		}
+	};
+
+	template<typename KNOWLEDGE>
+	constexpr typename FragmentPlan<KNOWLEDGE>::Plan FragmentPlan<KNOWLEDGE>::plan = FragmentPlan<KNOWLEDGE>::makePlan();
+}
+
+#endif // FRAGMENT_PLAN_H
@@ -12,6 +12,7 @@
 #define KNOWLEDGE_H
 
 #include <array>
+#include <cstdint>
 
 namespace CDEECO {
 	/**
@@ -24,6 +25,29 @@ namespace CDEECO {
 	 * \ingroup cdeeco
 	 */
 	typedef uint32_t Id;
+	/**
+	 * Knowledge version
+	 *
+	 * Incremented by the component on each knowledge change.
+	 *
+	 * \ingroup cdeeco
+	 */
+	typedef uint32_t Version;
+
+	/**
+	 * Compare knowledge versions
+	 *
+	 * Handles version counter wrap-around.
+	 *
+	 * @param version Version to compare
+	 * @param than Version to compare with
+	 * @return True when version is newer than the other one
+	 *
+	 * \ingroup cdeeco
+	 */
+	inline bool isNewerVersion(const Version version, const Version than) {
+		return (int32_t) (version - than) > 0;
+	}
 
 	/**
 	 * Knowledge interface
@@ -43,6 +67,9 @@ namespace CDEECO {
 	struct KnowledgeTrait {
 		static constexpr std::array<size_t, 0> offsets = {};
 	};
+
+	template<class KNOWLEDGE>
+	constexpr std::array<size_t, 0> KnowledgeTrait<KNOWLEDGE>::offsets;
 }
 
 #endif // KNOWLEDGE_H
@@ -42,7 +42,9 @@
 
 #include "main.h"
 #include "wrappers/FreeRTOSMutex.h"
+#include "KnowledgeFields.h"
 #include "KnowledgeFragment.h"
+#include "FragmentPlan.h"
 
 namespace CDEECO {
 	/**
@@ -63,7 +65,7 @@ namespace CDEECO {
 		 *
 		 * @param fragment Knowledge fragment to store
 		 */
-		virtual void storeFragment(const KnowledgeFragment fragment) = 0;
+		virtual void storeFragment(const KnowledgeFragment &fragment) = 0;
 	};
 
 	/**
@@ -89,6 +91,10 @@ namespace CDEECO {
 			CDEECO::Id id;
 			/** Time when the knowledge was received */
 			Timestamp timestamp;
+			/** Version of the knowledge data stored in each planned fragment range, valid once the range is available */
+			Version versions[FragmentPlan<KNOWLEDGE>::COUNT];
+			/** Library revision of the last record data change */
+			uint32_t revision;
 			/** Knowledge data combined from received fragments */
 			KNOWLEDGE knowledge;
 			/** Map of knowledge data availability. 0x00 means not available 0xff means that the byte is valid. */
@@ -141,6 +147,41 @@ namespace CDEECO {
 				return record;
 			}
 
+			/**
+			 * Copy knowledge of the current cache record when complete
+			 *
+			 * This copies neither the availability map nor the incomplete knowledge.
+			 *
+			 * @param id Set to id of the component which produced the knowledge
+			 * @param knowledge Set to copy of the record knowledge
+			 * @return Whenever the record is complete, outputs are set only for complete record
+			 */
+			bool readComplete(Id &id, KNOWLEDGE &knowledge) {
+				library.cacheAccess.lock();
+				const bool complete = library.cache[index].complete;
+				if(complete) {
+					id = library.cache[index].id;
+					knowledge = library.cache[index].knowledge;
+				}
+				library.cacheAccess.unlock();
+				return complete;
+			}
+
+			/**
+			 * Check whenever current cache record changed since library revision
+			 *
+			 * This do not copy the record.
+			 *
+			 * @param revision Library revision to compare with
+			 * @return True when the record data changed after the revision
+			 */
+			bool changedSince(const uint32_t revision) {
+				library.cacheAccess.lock();
+				bool changed = isNewerVersion(library.cache[index].revision, revision);
+				library.cacheAccess.unlock();
+				return changed;
+			}
+
 			/**
 			 * Check whenever library iterators are unequal
 			 *
@@ -189,11 +230,27 @@ namespace CDEECO {
 			return Iterator(*this, cacheSize);
 		}
 
+		/**
+		 * Get library revision
+		 *
+		 * The revision is incremented on each record data change.
+		 *
+		 * @return Current library revision
+		 */
+		uint32_t getRevision() {
+			cacheAccess.lock();
+			uint32_t current = revision;
+			cacheAccess.unlock();
+			return current;
+		}
+
 	protected:
 		/// Pointer to the first element in the cache this library belongs to
 		CacheRecord *cache;
 		/// Size of the cache this library belongs to
 		size_t cacheSize;
+		/// Number of record data changes
+		uint32_t revision = 0;
 		/**
 		 * Mutex for accessing cache records
 		 * It is placed here in order to be visible in the KnowledgeCache class too.
@@ -231,10 +288,32 @@ namespace CDEECO {
 		virtual ~KnowledgeCache() {
 		}
 
-		void storeFragment(const KnowledgeFragment fragment) {
+		/// Magic number of component producing knowledge stored in this cache
+		static const Type CacheType = TYPE;
+		/**
+		 * Time after which a record accepts older knowledge versions
+		 *
+		 * Longer than the maximal rebroadcast delay, so late rebroadcasted fragments are rejected. Once the record is
+		 * not updated for this time the producer is considered restarted with new version counter.
+		 */
+		static const uint32_t VERSION_TIMEOUT_MS = 10000;
+
+		void storeFragment(const KnowledgeFragment &fragment) {
 			if(fragment.type != TYPE)
 				return; // Not our knowledge type
 
+			insertFragment(fragment);
+		}
+
+		/**
+		 * Store knowledge fragment without checking its type
+		 *
+		 * Used by callers that have already matched the fragment type to this cache, thus no virtual call and type
+		 * check is needed.
+		 *
+		 * @param fragment Knowledge fragment of this cache's knowledge type
+		 */
+		void insertFragment(const KnowledgeFragment &fragment) {
 			console.print(Debug, ">>> Storing fragment in cache\n");
 
 			this->cacheAccess.lock();
@@ -254,13 +333,17 @@ namespace CDEECO {
 					oldest = i;
 			}
 
-			// Replace oldest knowledge
-			writeCache(oldest, fragment);
+			// Replace oldest knowledge, delta cannot be applied without previous data
+			if(!fragment.delta)
+				writeCache(oldest, fragment);
 
 			this->cacheAccess.unlock();
 		}
 
 	private:
+		/// Fragmentation plan of the knowledge
+		typedef FragmentPlan<KNOWLEDGE> Plan;
+
 		/// Static array of cache records
 		std::array<typename KnowledgeLibrary<KNOWLEDGE>::CacheRecord, SIZE> cache;
 
@@ -268,30 +351,94 @@ namespace CDEECO {
 		 * Update cache record
 		 *
 		 * This patches the cached knowledge with the new data and updates availability mask.
-		 * The complete flag is also updated when needed.
+		 * The complete flag is also updated when needed. Versions are kept for each planned fragment range, thus
+		 * fragments of different ranges are accepted in any order. Fragments older than the data stored in their range
+		 * are rejected and fragments already stored in the record only refresh its time-stamp. Delta fragments are
+		 * applied only when the record holds the data the delta was computed against.
 		 *
 		 * @param index Index of cache record to update
 		 * @param fragment Knowledge fragment to update the record with
 		 */
-		void updateCache(size_t index, const KnowledgeFragment fragment) {
-			assert_param(fragment.size + fragment.offset <= sizeof(KNOWLEDGE));
+		void updateCache(size_t index, const KnowledgeFragment &fragment) {
+			const size_t size = fragment.delta ? fragment.deltaLength() : fragment.size;
+			if(fragment.delta && (size == 0 || size + fragment.offset > sizeof(KNOWLEDGE)))
+				return;
+			assert_param(size + fragment.offset <= sizeof(KNOWLEDGE));
+
+			const typename KnowledgeLibrary<KNOWLEDGE>::Timestamp now = xTaskGetTickCount();
+
+			// Planned fragment ranges covered by the fragment
+			const size_t first = Plan::fragmentOf(fragment.offset);
+			const size_t last = Plan::fragmentOf(fragment.offset + size - 1);
+			Version *versions = cache[index].versions;
+
+			// Reject stale fragment unless the record has not been updated for long time, empty ranges have no version
+			const bool expired = now - cache[index].timestamp >= VERSION_TIMEOUT_MS / portTICK_PERIOD_MS;
+			bool stored = true;
+			for(size_t i = first; i <= last; ++i) {
+				if(!isAvailable(index, Plan::getFragment(i).start, Plan::getFragment(i).size)) {
+					stored = false;
+					continue;
+				}
+				if(isNewerVersion(versions[i], fragment.version) && !expired) {
+					console.print(Debug, ">>> Rejecting stale fragment\n");
+					return;
+				}
+				stored = stored && versions[i] == fragment.version;
+			}
+
+			// Skip data update when the fragment is already stored
+			if(stored && isAvailable(index, fragment.offset, size)) {
+				cache[index].timestamp = now;
+				return;
+			}
 
 			// Set knowledge data
-			memcpy(((char*) &cache[index].knowledge) + fragment.offset, fragment.data, fragment.size);
+			char *target = ((char*) &cache[index].knowledge) + fragment.offset;
+			if(fragment.delta) {
+				if(!isAvailable(index, fragment.offset, size) || hashData(target, size) != fragment.base) {
+					console.print(Debug, ">>> Dropping delta fragment with unknown base\n");
+					return;
+				}
+				fragment.applyDelta(target);
+			} else {
+				memcpy(target, fragment.data, fragment.size);
+			}
 
 			// Update availability
-			memset(((char*) &cache[index].availability) + fragment.offset, 0xff, fragment.size);
+			memset(((char*) &cache[index].availability) + fragment.offset, 0xff, size);
 
 			// Check whenever the knowledge is complete
 			bool complete = true;
 			for(size_t i = 0; i < sizeof(KNOWLEDGE); ++i)
-				if(((char*) &cache[index].availability)[i] != 0xff)
+				if(((uint8_t*) &cache[index].availability)[i] != 0xff)
 					complete = false;
 			if(complete)
 				cache[index].complete = true;
 
-			// Set last updated time-stamp
-			cache[index].timestamp = xTaskGetTickCount();
+			// Set versions, revision and last updated time-stamp
+			for(size_t i = first; i <= last; ++i)
+				versions[i] = fragment.version;
+			cache[index].revision = ++this->revision;
+			cache[index].timestamp = now;
+
+			const auto fields = KnowledgeFields<KNOWLEDGE>::fields();
+			console.logFields(fields.data(), fields.size(), &cache[index].knowledge, fragment.offset, size);
+		}
+
+		/**
+		 * Check whenever record data range is available
+		 *
+		 * @param index Index of cache record to check
+		 * @param offset Range offset in the knowledge
+		 * @param size Range size
+		 * @return True when the whole range is available
+		 */
+		bool isAvailable(size_t index, size_t offset, size_t size) {
+			for(size_t i = offset; i < offset + size; ++i)
+				if(((uint8_t*) &cache[index].availability)[i] != 0xff)
+					return false;
+			return true;
 		}
 
 		/**
@@ -302,7 +449,7 @@ namespace CDEECO {
 		 * @param index Record index to overwrite
 		 * @param fragment Initial fragment to store, used for id and initial update
 		 */
-		void writeCache(size_t index, const KnowledgeFragment fragment) {
+		void writeCache(size_t index, const KnowledgeFragment &fragment) {
 			cache[index].id = fragment.id;
 			memset(&cache[index].availability, 0, sizeof(KNOWLEDGE));
 			cache[index].complete = false;
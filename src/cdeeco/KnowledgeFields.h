@@ -0,0 +1,194 @@
+/**
+ * \ingroup cdeeco
+ * @file KnowledgeFields.h
+ *
+ * Compile-time field descriptors of the knowledge
+ *
+ * \date 16. 10. 2026
+ *
+ * The knowledge is handled as plain memory. Field descriptors tell the framework where the knowledge fields are, how
+ * large they are and what type they hold. Descriptors are declared once for the knowledge type using the
+ * CDEECO_KNOWLEDGE_FIELDS and CDEECO_FIELD macros. Knowledge without descriptors is handled as plain memory.
+ *
+ * Example:
+ * @code
+ * CDEECO_KNOWLEDGE_FIELDS(Submarine::Knowledge,
+ *		CDEECO_FIELD(position.lat),
+ *		CDEECO_FIELD(position.lon),
+ *		CDEECO_FIELD(depth))
+ * @endcode
+ */
+
+#ifndef KNOWLEDGE_FIELDS_H
+#define KNOWLEDGE_FIELDS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace CDEECO {
+	/**
+	 * Type of the value held by the field
+	 *
+	 * \ingroup cdeeco
+	 */
+	enum class FieldType : uint8_t {
+		/// Plain memory, structures
+		Raw,
+		/// Boolean value
+		Bool,
+		/// Signed integer
+		Int,
+		/// Unsigned integer
+		Uint,
+		/// Floating point number
+		Float
+	};
+
+	/**
+	 * Knowledge field descriptor
+	 *
+	 * Array fields are described by their element type and the number of elements.
+	 *
+	 * \ingroup cdeeco
+	 */
+	struct FieldDescriptor {
+		/// Field name
+		const char *name;
+		/// Field offset in the knowledge
+		uint16_t offset;
+		/// Field size
+		uint16_t size;
+		/// Number of elements, 1 for fields that are not arrays
+		uint16_t count;
+		/// Type of the value or array element
+		FieldType type;
+
+		/**
+		 * Get size of single element
+		 *
+		 * @return Element size
+		 */
+		constexpr size_t elementSize() const {
+			return size / count;
+		}
+	};
+
+	/**
+	 * Field value type information
+	 *
+	 * @tparam T Field type
+	 *
+	 * \ingroup cdeeco
+	 */
+	template<typename T>
+	struct FieldInfo {
+		/// Number of elements
+		static const uint16_t COUNT = 1;
+		/// Value type
+		static constexpr FieldType TYPE =
+				std::is_same<T, bool>::value ? FieldType::Bool :
+				std::is_floating_point<T>::value ? FieldType::Float :
+				std::is_integral<T>::value ? (std::is_signed<T>::value ? FieldType::Int : FieldType::Uint) :
+				FieldType::Raw;
+	};
+
+	/// Field value type information for std::array fields
+	template<typename T, size_t N>
+	struct FieldInfo<std::array<T, N>> {
+		static const uint16_t COUNT = N;
+		static constexpr FieldType TYPE = FieldInfo<T>::TYPE;
+	};
+
+	/// Field value type information for array fields
+	template<typename T, size_t N>
+	struct FieldInfo<T[N]> {
+		static const uint16_t COUNT = N;
+		static constexpr FieldType TYPE = FieldInfo<T>::TYPE;
+	};
+
+	/**
+	 * Create field descriptor
+	 *
+	 * @tparam T Field type
+	 * @param name Field name
+	 * @param offset Field offset in the knowledge
+	 * @return Field descriptor
+	 *
+	 * \ingroup cdeeco
+	 */
+	template<typename T>
+	constexpr FieldDescriptor makeField(const char *name, const size_t offset) {
+		return { name, (uint16_t) offset, (uint16_t) sizeof(T), FieldInfo<T>::COUNT, FieldInfo<T>::TYPE };
+	}
+
+	/**
+	 * Create array of field descriptors
+	 *
+	 * @param fields Field descriptors
+	 * @return Array of field descriptors
+	 *
+	 * \ingroup cdeeco
+	 */
+	template<typename ... FIELDS>
+	constexpr std::array<FieldDescriptor, sizeof...(FIELDS)> makeFields(const FIELDS ... fields) {
+		return { { fields... } };
+	}
+
+	/**
+	 * Knowledge fields
+	 *
+	 * Specialized by CDEECO_KNOWLEDGE_FIELDS, the general version describes no fields.
+	 *
+	 * @tparam KNOWLEDGE Knowledge type
+	 *
+	 * \ingroup cdeeco
+	 */
+	template<class KNOWLEDGE>
+	struct KnowledgeFields {
+		/**
+		 * Get field descriptors
+		 *
+		 * @return Array of field descriptors ordered by offset
+		 */
+		static constexpr std::array<FieldDescriptor, 0> fields() {
+			return { };
+		}
+	};
+}
+
+/**
+ * Describe knowledge field
+ *
+ * To be used as argument of CDEECO_KNOWLEDGE_FIELDS.
+ *
+ * @param MEMBER Knowledge member, nested members are allowed
+ *
+ * \ingroup cdeeco
+ */
+#define CDEECO_FIELD(MEMBER) \
+	CDEECO::makeField<decltype(((Knowledge*) nullptr)->MEMBER)>(#MEMBER, offsetof(Knowledge, MEMBER))
+
+/**
+ * Describe knowledge fields
+ *
+ * Has to be used outside of any name-space, right after the knowledge definition.
+ *
+ * @param KNOWLEDGE Knowledge type
+ * @param ... Fields described by CDEECO_FIELD ordered by offset
+ *
+ * \ingroup cdeeco
+ */
+#define CDEECO_KNOWLEDGE_FIELDS(KNOWLEDGE, ...) \
+	namespace CDEECO { \
+		template<> \
+		struct KnowledgeFields<KNOWLEDGE> { \
+			typedef KNOWLEDGE Knowledge; \
+			static constexpr auto fields() { \
+				return makeFields(__VA_ARGS__); \
+			} \
+		}; \
+	}
+
+#endif // KNOWLEDGE_FIELDS_H
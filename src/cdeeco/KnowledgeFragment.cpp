@@ -0,0 +1,168 @@
+/**
+ * \ingroup cdeeco
+ * @file KnowledgeFragment.cpp
+ *
+ * CDEECo++ knowledge fragment wire encoding implementation
+ *
+ * \date 16. 10. 2026
+ */
+
+#include "KnowledgeFragment.h"
+
+namespace CDEECO {
+	namespace {
+		/**
+		 * Write variable length unsigned integer
+		 *
+		 * @param buffer Output position, advanced past the written value
+		 * @param value Value to write
+		 */
+		void writeVarint(uint8_t *&buffer, uint32_t value) {
+			while(value >= 0x80) {
+				*buffer++ = (uint8_t) (value | 0x80);
+				value >>= 7;
+			}
+			*buffer++ = (uint8_t) value;
+		}
+
+		/**
+		 * Read variable length unsigned integer
+		 *
+		 * @param buffer Input position, advanced past the read value
+		 * @param end End of the input
+		 * @param value Read value
+		 * @param max Maximal allowed value
+		 * @return Whenever valid value was read
+		 */
+		bool readVarint(const uint8_t *&buffer, const uint8_t *end, uint32_t &value, const uint32_t max) {
+			value = 0;
+			for(size_t shift = 0; shift < 32; shift += 7) {
+				if(buffer == end)
+					return false;
+				const uint8_t byte = *buffer++;
+				if(shift == 28 && (byte & 0x70))
+					return false;
+				value |= (uint32_t) (byte & 0x7f) << shift;
+				if(!(byte & 0x80))
+					return value <= max;
+			}
+			return false;
+		}
+	}
+
+	size_t KnowledgeFragment::encode(uint8_t *buffer) const {
+		uint8_t *pos = buffer;
+		writeVarint(pos, type);
+		writeVarint(pos, id);
+		writeVarint(pos, version);
+		writeVarint(pos, size);
+		writeVarint(pos, offset << 1 | delta);
+		if(delta)
+			for(size_t i = 0; i < sizeof(base); ++i)
+				*pos++ = (uint8_t) (base >> (8 * i));
+		memcpy(pos, data, size);
+		return pos - buffer + size;
+	}
+
+	size_t KnowledgeFragment::decode(const uint8_t *buffer, const size_t size) {
+		const uint8_t *pos = buffer;
+		const uint8_t *end = buffer + size;
+		uint32_t fragmentSize;
+		uint32_t fragmentOffset;
+
+		if(!readVarint(pos, end, type, UINT32_MAX) || !readVarint(pos, end, id, UINT32_MAX)
+				|| !readVarint(pos, end, version, UINT32_MAX) || !readVarint(pos, end, fragmentSize, MAX_DATA_SIZE)
+				|| !readVarint(pos, end, fragmentOffset, UINT16_MAX << 1 | 1))
+			return 0;
+
+		// Read delta base hash
+		delta = fragmentOffset & 1;
+		base = 0;
+		if(delta) {
+			if((size_t) (end - pos) < sizeof(base))
+				return 0;
+			for(size_t i = 0; i < sizeof(base); ++i)
+				base |= (uint32_t) *pos++ << (8 * i);
+		}
+
+		if(fragmentSize > (size_t) (end - pos))
+			return 0;
+
+		this->size = fragmentSize;
+		this->offset = fragmentOffset >> 1;
+		memcpy(data, pos, fragmentSize);
+		return pos - buffer + fragmentSize;
+	}
+
+	bool KnowledgeFragment::setDelta(const void *current, const void *previous, const size_t length) {
+		const uint8_t *cur = (const uint8_t*) current;
+		const uint8_t *prev = (const uint8_t*) previous;
+		uint8_t *out = (uint8_t*) data;
+
+		delta = true;
+		const size_t limit = maxDataSize();
+		delta = false;
+
+		size_t written = 0;
+		for(size_t i = 0; i < length;) {
+			const bool zero = cur[i] == prev[i];
+
+			// Extend run while the bytes keep being equal or different
+			size_t run = 1;
+			while(i + run < length && run < RUN_LIMIT && (cur[i + run] == prev[i + run]) == zero)
+				run++;
+
+			const size_t needed = zero ? 1 : 1 + run;
+			if(written + needed > limit)
+				return false;
+
+			if(zero) {
+				out[written++] = ZERO_RUN | (run - 1);
+			} else {
+				out[written++] = run - 1;
+				for(size_t j = i; j < i + run; ++j)
+					out[written++] = cur[j] ^ prev[j];
+			}
+
+			i += run;
+		}
+
+		// Plain data are better
+		if(written >= length)
+			return false;
+
+		delta = true;
+		base = hashData(previous, length);
+		size = written;
+		return true;
+	}
+
+	size_t KnowledgeFragment::deltaLength() const {
+		const uint8_t *in = (const uint8_t*) data;
+		size_t length = 0;
+		for(size_t pos = 0; pos < size;) {
+			const uint8_t token = in[pos++];
+			const size_t run = (token & (ZERO_RUN - 1)) + 1;
+			if(!(token & ZERO_RUN)) {
+				if(pos + run > size)
+					return 0;
+				pos += run;
+			}
+			length += run;
+		}
+		return length;
+	}
+
+	void KnowledgeFragment::applyDelta(void *target) const {
+		const uint8_t *in = (const uint8_t*) data;
+		uint8_t *out = (uint8_t*) target;
+		for(size_t pos = 0; pos < size;) {
+			const uint8_t token = in[pos++];
+			const size_t run = (token & (ZERO_RUN - 1)) + 1;
+			if(!(token & ZERO_RUN))
+				for(size_t i = 0; i < run; ++i)
+					out[i] ^= in[pos++];
+			out += run;
+		}
+	}
+}
@@ -18,15 +18,50 @@
 
 namespace CDEECO {
 	/**
-	 * Knowledge fragment structure to be included directly in the packet
+	 * Compute FNV-1a hash of the data
+	 *
+	 * @param data Data to hash
+	 * @param size Data size
+	 * @param hash Hash of the preceding data, used to hash data in multiple steps
+	 * @return Hash of the data
+	 *
+	 * \ingroup cdeeco
+	 */
+	inline uint32_t hashData(const void *data, const size_t size, uint32_t hash = 2166136261u) {
+		for(size_t i = 0; i < size; ++i) {
+			hash ^= ((const uint8_t*) data)[i];
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+
+	/**
+	 * Knowledge fragment structure
+	 *
+	 * The fragment is not sent as contained in the memory. The header fields are encoded as variable length unsigned
+	 * integers, 7 bits per byte starting from the least significant ones with the highest bit set on all bytes but the
+	 * last. The data follow the header. Typical header takes 5 to 10 bytes instead of 16 bytes of the in-memory
+	 * structure, leaving more space for the data.
+	 *
+	 * Delta fragments carry the knowledge range XORed with the data the sender broadcasted previously for the same
+	 * range. The XOR result is compressed as a sequence of runs. Each run starts with a byte holding the run length
+	 * minus one in the lower 7 bits. Zero runs have the highest bit set and carry no data, literal runs are followed by
+	 * the literal bytes. The size of a delta fragment is the size of the compressed data. The delta flag is sent as the
+	 * lowest bit of the encoded offset and the base hash follows the offset in 4 bytes.
 	 *
 	 * \ingroup cdeeco
 	 */
 	struct KnowledgeFragment {
 		/// Maximum packet size
 		static const size_t MAX_PACKET_SIZE = 128;
-		/// Maximum size of the data part
-		static const size_t MAX_DATA_SIZE = 112;
+		/// Maximum size of the encoded fragment, 127 bytes of PHY frame without 7 bytes of MAC header and 2 bytes of FCS
+		static const size_t MAX_FRAME_PAYLOAD = 118;
+		/// Minimum size of the encoded header, all fields encoded in single byte
+		static const size_t MIN_HEADER_SIZE = 5;
+		/// Maximum size of the encoded header of plain fragment, 32-bit fields, 8-bit size and 16-bit offset
+		static const size_t MAX_HEADER_SIZE = 5 + 5 + 5 + 1 + 3;
+		/// Maximum size of the data part, fits the radio frame with the shortest header
+		static const size_t MAX_DATA_SIZE = MAX_FRAME_PAYLOAD - MIN_HEADER_SIZE;
 		/**
 		 * CDEECo++ magic value
 		 *
@@ -38,25 +73,140 @@ namespace CDEECO {
 		Type type;
 		/// Knowledge component id
 		Id id;
+		/// Version of the knowledge the fragment was taken from
+		Version version;
 		/// Fragment size
-		size_t size;
+		uint16_t size;
 		/// Fragment offset in the knowledge
-		size_t offset;
+		uint16_t offset;
+		/// Whenever the data are delta encoded
+		bool delta;
+		/// Hash of the knowledge range the delta applies to
+		uint32_t base;
 		/// Fragment data
 		char data[MAX_DATA_SIZE];
 
 		/**
-		 * Get used length of the packet
+		 * Get encoded header length
 		 *
-		 * @return Size of used packet part
+		 * @return Size of the encoded header
+		 */
+		size_t headerLength() const {
+			return varintLength(type) + varintLength(id) + varintLength(version) + varintLength(size)
+					+ varintLength(offset << 1 | delta) + (delta ? sizeof(base) : 0);
+		}
+
+		/**
+		 * Get encoded length of the fragment
+		 *
+		 * @return Size of the encoded header and data
 		 */
 		size_t length() const {
-			return sizeof(KnowledgeFragment) - MAX_DATA_SIZE + size;
+			return headerLength() + size;
+		}
+
+		/**
+		 * Get maximal encoded header length of plain fragment of given knowledge
+		 *
+		 * Type, id and version take up to 5 bytes each, size takes single byte and offset is bounded by the knowledge size.
+		 *
+		 * @param knowledgeSize Size of the knowledge
+		 * @return Maximal size of the encoded header
+		 */
+		static constexpr size_t maxHeaderLength(const size_t knowledgeSize) {
+			return 5 + 5 + 5 + 1 + varintLength(knowledgeSize << 1);
+		}
+
+		/**
+		 * Get maximal encoded length of plain fragment
+		 *
+		 * Type, id and version take up to 5 bytes each, size and offset are encoded as given.
+		 *
+		 * @param size Fragment size
+		 * @param offset Fragment offset in the knowledge
+		 * @return Maximal size of the encoded header and data
+		 */
+		static constexpr size_t maxLength(const size_t size, const size_t offset) {
+			return 5 + 5 + 5 + varintLength(size) + varintLength(offset << 1) + size;
+		}
+
+		/**
+		 * Get maximal data size with the current header
+		 *
+		 * Data size is always encoded in a single byte as it is lower than 128.
+		 *
+		 * @return Maximal fragment size fitting the radio frame
+		 */
+		size_t maxDataSize() const {
+			return MAX_FRAME_PAYLOAD - varintLength(type) - varintLength(id) - varintLength(version) - 1
+					- varintLength(offset << 1 | delta) - (delta ? sizeof(base) : 0);
+		}
+
+		/**
+		 * Set delta encoded data
+		 *
+		 * The header fields have to be set. When the delta does not fit the packet or it is not smaller than the
+		 * plain data the fragment is left plain and its data have to be set by the caller.
+		 *
+		 * @param current Current data of the knowledge range
+		 * @param previous Previously broadcasted data of the knowledge range
+		 * @param length Knowledge range length
+		 * @return Whenever the delta was set
+		 */
+		bool setDelta(const void *current, const void *previous, const size_t length);
+
+		/**
+		 * Get length of the knowledge range covered by the delta
+		 *
+		 * @return Range length or 0 when the delta is malformed
+		 */
+		size_t deltaLength() const;
+
+		/**
+		 * Apply delta on the knowledge range
+		 *
+		 * The range has to hold data matching the base hash and to be deltaLength() bytes long.
+		 *
+		 * @param target Knowledge range to patch
+		 */
+		void applyDelta(void *target) const;
+
+		/**
+		 * Encode fragment
+		 *
+		 * @param buffer Buffer for the encoded fragment, has to hold at least length() bytes
+		 * @return Encoded length
+		 */
+		size_t encode(uint8_t *buffer) const;
+
+		/**
+		 * Decode fragment
+		 *
+		 * @param buffer Buffer holding encoded fragment
+		 * @param size Buffer size
+		 * @return Decoded length or 0 when the buffer does not hold valid fragment
+		 */
+		size_t decode(const uint8_t *buffer, const size_t size);
+
+	private:
+		/// Flag marking zero run in delta encoded data
+		static const uint8_t ZERO_RUN = 0x80;
+		/// Maximal length of single run in delta encoded data
+		static const size_t RUN_LIMIT = 128;
+
+		/**
+		 * Get length of encoded value
+		 *
+		 * @param value Value to encode
+		 * @return Number of bytes used by the encoded value
+		 */
+		static constexpr size_t varintLength(const uint32_t value) {
+			return value >> 7 ? 1 + varintLength(value >> 7) : 1;
 		}
 	};
 
-	// Ensure knowledge fragment fits into a packet
-	static_assert(KnowledgeFragment::MAX_PACKET_SIZE == sizeof(KnowledgeFragment), "Knowledge fragment size not equal to packet size.");
+	// Ensure fragment size is always encoded in a single byte
+	static_assert(KnowledgeFragment::MAX_DATA_SIZE < 128, "Knowledge fragment data size does not fit single byte.");
 }
 
 #endif // KNOWLEDGE_FRAGMENT_H
@@ -0,0 +1,206 @@
+/**
+ * \ingroup cdeeco
+ * @file PeriodicSchedule.h
+ *
+ * Drift-free periodic schedule with timing statistics
+ *
+ * \date 16. 10. 2026
+ *
+ * Releases are placed at absolute times, each one period after the previous release, thus the execution time and
+ * preemption do not delay the following releases. An execution finishing after the next release is an overrun. The
+ * missed releases are skipped and counted, the schedule keeps its phase.
+ */
+
+#ifndef PERIODIC_SCHEDULE_H
+#define PERIODIC_SCHEDULE_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace CDEECO {
+	/**
+	 * Timing statistics of periodic activity
+	 *
+	 * Times are in ticks. Updated without locking, thus a copy taken while the activity runs can mix two activations.
+	 *
+	 * \ingroup cdeeco
+	 */
+	struct TimingStats {
+		/// Number of activations
+		uint32_t activations;
+		/// Number of releases missed as the previous execution did not finish in time
+		uint32_t overruns;
+		/// Delay of the last activation after its release
+		TickType_t lastJitter;
+		/// Maximal delay of an activation after its release
+		TickType_t maxJitter;
+		/// Duration of the last execution
+		TickType_t lastExecution;
+		/// Maximal duration of an execution
+		TickType_t maxExecution;
+	};
+
+	/**
+	 * Periodic schedule
+	 *
+	 * \ingroup cdeeco
+	 */
+	class PeriodicSchedule {
+	public:
+		/**
+		 * Create periodic schedule
+		 *
+		 * @param periodMs Period in milliseconds
+		 */
+		PeriodicSchedule(const uint32_t periodMs) {
+			setPeriod(periodMs);
+		}
+
+		/**
+		 * Set period
+		 *
+		 * Applies from the next release on.
+		 *
+		 * @param periodMs Period in milliseconds
+		 */
+		void setPeriod(const uint32_t periodMs) {
+			periodTicks = std::max<TickType_t>(1, periodMs / portTICK_PERIOD_MS);
+		}
+
+		/**
+		 * Get period
+		 *
+		 * @return Period in ticks
+		 */
+		TickType_t getPeriod() const {
+			return periodTicks;
+		}
+
+		/**
+		 * Set shortest period
+		 *
+		 * Schedules changing their period at run time are assigned priorities and checked with the shortest period
+		 * they can run at.
+		 *
+		 * @param minPeriodMs Shortest period in milliseconds, 0 for the current period
+		 */
+		void setMinPeriod(const uint32_t minPeriodMs) {
+			minPeriodTicks = minPeriodMs > 0 ? std::max<TickType_t>(1, minPeriodMs / portTICK_PERIOD_MS) : 0;
+		}
+
+		/**
+		 * Get shortest period
+		 *
+		 * @return Shortest period in ticks
+		 */
+		TickType_t getMinPeriod() const {
+			return minPeriodTicks > 0 ? minPeriodTicks : periodTicks;
+		}
+
+		/**
+		 * Set relative deadline
+		 *
+		 * The deadline is used by the priority assignment and the schedulability check only.
+		 *
+		 * @param deadlineMs Deadline after release in milliseconds, 0 for deadline equal to the shortest period
+		 */
+		void setDeadline(const uint32_t deadlineMs) {
+			deadlineTicks = deadlineMs / portTICK_PERIOD_MS;
+		}
+
+		/**
+		 * Get relative deadline
+		 *
+		 * @return Deadline after release in ticks
+		 */
+		TickType_t getDeadline() const {
+			return deadlineTicks > 0 ? deadlineTicks : getMinPeriod();
+		}
+
+		/**
+		 * Start the schedule
+		 *
+		 * @param delayMs Delay of the first release from now in milliseconds
+		 */
+		void start(const uint32_t delayMs = 0) {
+			lastRelease = xTaskGetTickCount() + delayMs / portTICK_PERIOD_MS - periodTicks;
+		}
+
+		/**
+		 * Get next release time
+		 *
+		 * @return Tick of the next release
+		 */
+		TickType_t getRelease() const {
+			return lastRelease + periodTicks;
+		}
+
+		/**
+		 * Wait for the next release
+		 *
+		 * Returns immediately when the release has already passed.
+		 */
+		void waitRelease() {
+			TickType_t previous = lastRelease;
+			vTaskDelayUntil(&previous, periodTicks);
+		}
+
+		/**
+		 * Record activation
+		 *
+		 * Has to be called at the start of the execution, once the next release has passed.
+		 */
+		void activated() {
+			lastRelease += periodTicks;
+			activationTime = xTaskGetTickCount();
+			stats.activations++;
+			stats.lastJitter = activationTime - lastRelease;
+			stats.maxJitter = std::max(stats.maxJitter, stats.lastJitter);
+		}
+
+		/**
+		 * Record execution end
+		 *
+		 * Skips the releases missed by the execution.
+		 */
+		void completed() {
+			const TickType_t now = xTaskGetTickCount();
+			stats.lastExecution = now - activationTime;
+			stats.maxExecution = std::max(stats.maxExecution, stats.lastExecution);
+
+			const TickType_t missed = (now - lastRelease) / periodTicks;
+			if(missed > 0) {
+				stats.overruns += missed;
+				lastRelease += missed * periodTicks;
+			}
+		}
+
+		/**
+		 * Get timing statistics
+		 *
+		 * @return Timing statistics
+		 */
+		TimingStats getStats() const {
+			return stats;
+		}
+
+	private:
+		/// Period in ticks
+		TickType_t periodTicks;
+		/// Shortest period in ticks, 0 for the current period
+		TickType_t minPeriodTicks = 0;
+		/// Relative deadline in ticks, 0 for deadline equal to the shortest period
+		TickType_t deadlineTicks = 0;
+		/// Time of the last release
+		TickType_t lastRelease = 0;
+		/// Time of the last activation
+		TickType_t activationTime = 0;
+		/// Timing statistics
+		TimingStats stats = { };
+	};
+}
+
+#endif // PERIODIC_SCHEDULE_H
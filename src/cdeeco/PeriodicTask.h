@@ -15,6 +15,9 @@
 #include "task.h"
 
 #include "Task.h"
+#include "PeriodicSchedule.h"
+#include "Activity.h"
+#include "StackSizes.h"
 #include "Console.h"
 #include "wrappers/FreeRTOSTask.h"
 
@@ -24,11 +27,12 @@ namespace CDEECO {
 	 *
 	 * @tparam KNOWLEDGE Type of the this task's component's knowledge
 	 * @tparam OUT_KNOWLEDGE Type of this task output knowledge
+	 * @tparam IN_KNOWLEDGE Type of this task input knowledge, the whole component's knowledge by default
 	 *
 	 * \ingroup cdeeco
 	 */
-	template<typename KNOWLEDGE, typename OUT_KNOWLEDGE>
-	class PeriodicTask: Task<KNOWLEDGE, OUT_KNOWLEDGE>, FreeRTOSTask {
+	template<typename KNOWLEDGE, typename OUT_KNOWLEDGE, typename IN_KNOWLEDGE = KNOWLEDGE>
+	class PeriodicTask: Task<KNOWLEDGE, OUT_KNOWLEDGE, IN_KNOWLEDGE>, Activity {
 	public:
 		/**
 		 * Create the periodic task
@@ -37,13 +41,35 @@ namespace CDEECO {
 		 * @param component Component owning this task
 		 * @param outKnowledge Reference to output knowledge.
 		 * 			Output knowledge should be member of component's knowledge.
-		 * @param stack Stack size of the task
+		 * @param stack Stack size of the task in words
 		 * @param priority Task priority
 		 */
-		PeriodicTask(long period, auto &component, auto &outKnowledge, size_t stack = FreeRTOSTask::DEFAULT_STACK_SIZE,
+		PeriodicTask(long period, auto &component, auto &outKnowledge, size_t stack = CDEECO_PERIODIC_STACK,
 				unsigned long priority = FreeRTOSTask::DEFAULT_PRIORITY) :
-				Task<KNOWLEDGE, OUT_KNOWLEDGE>(component, outKnowledge), FreeRTOSTask(stack, priority), period(period) {
+				Task<KNOWLEDGE, OUT_KNOWLEDGE, IN_KNOWLEDGE>(component, outKnowledge),
+						Activity(stack, priority, "Periodic"), schedule(period) {
 			console.print(Debug, ">> PeriodicTask constructor\n");
+			setSchedule(schedule);
+		}
+
+		/**
+		 * Create the periodic task with knowledge member as input
+		 *
+		 * @param period task execution period in milliseconds
+		 * @param component Component owning this task
+		 * @param outKnowledge Reference to output knowledge.
+		 * 			Output knowledge should be member of component's knowledge.
+		 * @param inKnowledge Pointer to input knowledge.
+		 * 			Input knowledge should be member of component's knowledge.
+		 * @param stack Stack size of the task in words
+		 * @param priority Task priority
+		 */
+		PeriodicTask(long period, auto &component, auto &outKnowledge, const IN_KNOWLEDGE *inKnowledge, size_t stack =
+				CDEECO_PERIODIC_STACK, unsigned long priority = FreeRTOSTask::DEFAULT_PRIORITY) :
+				Task<KNOWLEDGE, OUT_KNOWLEDGE, IN_KNOWLEDGE>(component, outKnowledge, inKnowledge), Activity(stack,
+						priority, "Periodic"), schedule(period) {
+			console.print(Debug, ">> PeriodicTask constructor\n");
+			setSchedule(schedule);
 		}
 
 		/**
@@ -51,34 +77,86 @@ namespace CDEECO {
 		 *
 		 * @param period task execution period in milliseconds
 		 * @param component Component owning this task
-		 * @param stack Stack size of the task
+		 * @param stack Stack size of the task in words
 		 * @param priority Task priority
 		 */
-		PeriodicTask(long period, auto &component, size_t stack = FreeRTOSTask::DEFAULT_STACK_SIZE,
+		PeriodicTask(long period, auto &component, size_t stack = CDEECO_PERIODIC_STACK,
 				unsigned long priority = FreeRTOSTask::DEFAULT_PRIORITY) :
-				Task<KNOWLEDGE, OUT_KNOWLEDGE>(component), FreeRTOSTask(stack, priority), period(period) {
+				Task<KNOWLEDGE, OUT_KNOWLEDGE, IN_KNOWLEDGE>(component),
+						Activity(stack, priority, "Periodic"), schedule(period) {
 			console.print(Debug, ">> PeriodicTask constructor\n");
+			setSchedule(schedule);
+		}
+
+		/**
+		 * Create the periodic task without output with knowledge member as input
+		 *
+		 * @param period task execution period in milliseconds
+		 * @param component Component owning this task
+		 * @param inKnowledge Pointer to input knowledge.
+		 * 			Input knowledge should be member of component's knowledge.
+		 * @param stack Stack size of the task in words
+		 * @param priority Task priority
+		 */
+		PeriodicTask(long period, auto &component, const IN_KNOWLEDGE *inKnowledge, size_t stack =
+				CDEECO_PERIODIC_STACK, unsigned long priority = FreeRTOSTask::DEFAULT_PRIORITY) :
+				Task<KNOWLEDGE, OUT_KNOWLEDGE, IN_KNOWLEDGE>(component, inKnowledge),
+						Activity(stack, priority, "Periodic"), schedule(period) {
+			console.print(Debug, ">> PeriodicTask constructor\n");
+			setSchedule(schedule);
+		}
+
+		/**
+		 * Get timing statistics
+		 *
+		 * @return Activation jitter, execution time and overruns of this task
+		 */
+		TimingStats getTimingStats() {
+			return schedule.getStats();
 		}
 
 	private:
-		/// Period of this task in milliseconds
-		long period;
+		/// Schedule of this task
+		PeriodicSchedule schedule;
 
 		/**
 		 * Periodic task body implementation
 		 *
-		 * Responsible for periodic scheduling.
+		 * Responsible for periodic scheduling. Executions are released at absolute times, thus the period does not
+		 * drift by the execution time.
 		 */
 		void run() {
 			// Schedule the task periodically
+			schedule.start();
 			while(1) {
-				// Run the task
-				this->execute();
-
 				// Wait for next execution time
-				vTaskDelay(this->period / portTICK_PERIOD_MS);
+				schedule.waitRelease();
+
+				step();
 			}
 		}
+
+		/**
+		 * Start periodic job
+		 *
+		 * @return Time of the first execution
+		 */
+		TickType_t start() {
+			schedule.start();
+			return schedule.getRelease();
+		}
+
+		/**
+		 * Run the task once
+		 *
+		 * @return Time of the next execution
+		 */
+		TickType_t step() {
+			schedule.activated();
+			this->execute();
+			schedule.completed();
+			return schedule.getRelease();
+		}
 	};
 }
 
@@ -0,0 +1,134 @@
+/**
+ * \ingroup cdeeco
+ * @file PriorityAssignment.cpp
+ *
+ * Priority assignment of periodic activities implementation
+ *
+ * \date 16. 10. 2026
+ */
+
+#include "PriorityAssignment.h"
+
+#include <algorithm>
+
+#include "main.h"
+
+namespace CDEECO {
+	PriorityAssignment::PriorityAssignment(const uint32_t warmupMs) :
+			FreeRTOSTask(DEFAULT_STACK_SIZE, DEFAULT_PRIORITY, "SchedChk"), warmupMs(warmupMs) {
+	}
+
+	void PriorityAssignment::assign(const Order order, const unsigned long lowest, const unsigned long highest) {
+		assert_param(lowest <= highest && highest < DRIVER_PRIORITY);
+		const unsigned long levels = highest - lowest + 1;
+
+		size_t keys = 0;
+		for(Activity *activity = Activity::getFirst(); activity != NULL; activity = activity->getNext())
+			if(activity->getSchedule() != NULL && isFirstKey(*activity, order))
+				keys++;
+
+		console.print(Info, ">>> Priority assignment by %s:\n", order == Order::Period ? "period" : "deadline");
+		for(Activity *activity = Activity::getFirst(); activity != NULL; activity = activity->getNext()) {
+			if(activity->getSchedule() == NULL)
+				continue;
+
+			// Rank among the distinct keys, 0 for the shortest one
+			const TickType_t key = getKey(*activity, order);
+			size_t rank = 0;
+			for(Activity *other = Activity::getFirst(); other != NULL; other = other->getNext())
+				if(other->getSchedule() != NULL && isFirstKey(*other, order) && getKey(*other, order) < key)
+					rank++;
+
+			const unsigned long priority = highest - rank * levels / keys;
+			activity->setPriority(priority);
+			console.print(Info, ">>> %-10s period %6u ms deadline %6u ms priority %u\n", activity->getName(),
+					(unsigned) (activity->getSchedule()->getMinPeriod() * portTICK_PERIOD_MS),
+					(unsigned) (activity->getSchedule()->getDeadline() * portTICK_PERIOD_MS), (unsigned) priority);
+		}
+	}
+
+	bool PriorityAssignment::check() {
+		bool schedulable = true;
+		bool measured = true;
+		uint32_t utilization = 0;
+
+		console.print(Info, ">>> Schedulability check:\n");
+		for(Activity *activity = Activity::getFirst(); activity != NULL; activity = activity->getNext()) {
+			const PeriodicSchedule *schedule = activity->getSchedule();
+			if(schedule == NULL)
+				continue;
+
+			if(schedule->getStats().activations == 0) {
+				measured = false;
+				console.print(Info, ">>> %-10s priority %u not measured\n", activity->getName(),
+						(unsigned) activity->getPriority());
+				continue;
+			}
+
+			const TickType_t response = getResponse(*activity);
+			const bool met = response <= schedule->getDeadline();
+			schedulable = schedulable && met;
+			utilization += getExecution(*activity) * 1000 / schedule->getMinPeriod();
+			console.print(Info, ">>> %-10s priority %u execution %5u ms response %5u ms deadline %6u ms %s\n",
+					activity->getName(), (unsigned) activity->getPriority(),
+					(unsigned) (getExecution(*activity) * portTICK_PERIOD_MS),
+					(unsigned) (response * portTICK_PERIOD_MS),
+					(unsigned) (schedule->getDeadline() * portTICK_PERIOD_MS), met ? "ok" : "MISSED");
+		}
+
+		console.print(Info, ">>> Utilization %u.%u %%, %s\n", (unsigned) (utilization / 10),
+				(unsigned) (utilization % 10),
+				!schedulable ? "NOT schedulable" : measured ? "schedulable" : "not all activities measured");
+		return schedulable && measured;
+	}
+
+	void PriorityAssignment::run() {
+		vTaskDelay(warmupMs / portTICK_PERIOD_MS);
+		check();
+		suspend();
+	}
+
+	TickType_t PriorityAssignment::getKey(const Activity &activity, const Order order) {
+		const PeriodicSchedule &schedule = *activity.getSchedule();
+		return order == Order::Period ? schedule.getMinPeriod() : schedule.getDeadline();
+	}
+
+	bool PriorityAssignment::isFirstKey(const Activity &activity, const Order order) {
+		const TickType_t key = getKey(activity, order);
+		for(Activity *other = Activity::getFirst(); other != &activity; other = other->getNext())
+			if(other->getSchedule() != NULL && getKey(*other, order) == key)
+				return false;
+		return true;
+	}
+
+	TickType_t PriorityAssignment::getExecution(const Activity &activity) {
+		return activity.getSchedule()->getStats().maxExecution + 1;
+	}
+
+	TickType_t PriorityAssignment::getResponse(const Activity &activity) {
+		const TickType_t deadline = activity.getSchedule()->getDeadline();
+
+		// Jobs of the same executor run to completion, the longest lower priority one can delay the activity
+		TickType_t blocking = 0;
+		for(Activity *other = Activity::getFirst(); other != NULL; other = other->getNext())
+			if(other->getSchedule() != NULL && activity.getExecutor() != NULL
+					&& other->getExecutor() == activity.getExecutor() && other->getPriority() < activity.getPriority())
+				blocking = std::max(blocking, getExecution(*other));
+
+		// Iterate the response time until it settles or misses the deadline
+		TickType_t response = blocking + getExecution(activity);
+		while(response <= deadline) {
+			TickType_t next = blocking + getExecution(activity);
+			for(Activity *other = Activity::getFirst(); other != NULL; other = other->getNext()) {
+				if(other == &activity || other->getSchedule() == NULL || other->getPriority() < activity.getPriority())
+					continue;
+				const TickType_t period = other->getSchedule()->getMinPeriod();
+				next += (response + period - 1) / period * getExecution(*other);
+			}
+			if(next == response)
+				break;
+			response = next;
+		}
+		return response;
+	}
+}
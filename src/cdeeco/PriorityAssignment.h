@@ -0,0 +1,124 @@
+/**
+ * \ingroup cdeeco
+ * @file PriorityAssignment.h
+ *
+ * Rate-monotonic priority assignment and schedulability check of periodic activities
+ *
+ * \date 16. 10. 2026
+ *
+ * The periodic tasks, ensembles and component broadcasts are collected from the list of activities. The shorter the
+ * period, or the relative deadline, the higher the priority. When there are more distinct periods than priority
+ * levels, adjacent periods share a level, thus the order is kept. Periods changing at run time, such as the adaptive
+ * broadcast period, are represented by their shortest value in both the assignment and the check.
+ *
+ * The schedulability check runs the response time analysis with the measured maximal execution times. Execution
+ * times are measured in ticks, thus one tick is added to each. Activities running as jobs of the same executor do not
+ * preempt each other, thus a job can be blocked by the longest lower priority job. Triggered tasks and the radio are
+ * not periodic and are not part of the analysis. The top priority level is reserved for the radio and other driver
+ * tasks, so the activities never delay them. Triggered tasks keep the default priority.
+ *
+ * Example:
+ * @code
+ * cdeecoSetup(uniqId);
+ * CDEECO::PriorityAssignment::assign();
+ * new CDEECO::PriorityAssignment(30000);
+ * @endcode
+ */
+
+#ifndef PRIORITY_ASSIGNMENT_H
+#define PRIORITY_ASSIGNMENT_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <cstdint>
+
+#include "Activity.h"
+#include "wrappers/FreeRTOSTask.h"
+
+namespace CDEECO {
+	/**
+	 * Priority assignment of periodic activities
+	 *
+	 * \ingroup cdeeco
+	 */
+	class PriorityAssignment: FreeRTOSTask {
+	public:
+		/// Order of the priorities
+		enum class Order {
+			/// Shorter period, higher priority
+			Period,
+			/// Shorter relative deadline, higher priority
+			Deadline
+		};
+
+		/// Highest priority available to the activities, below the driver priority
+		static const unsigned long HIGHEST_PRIORITY = DRIVER_PRIORITY - 1;
+
+		/**
+		 * Create task checking the schedulability once the execution times are measured
+		 *
+		 * @param warmupMs Time to measure the execution times for in milliseconds
+		 */
+		PriorityAssignment(const uint32_t warmupMs);
+
+		/**
+		 * Assign priorities to periodic activities and log them
+		 *
+		 * @param order Order of the priorities
+		 * @param lowest Priority of the activity with the longest period
+		 * @param highest Priority of the activity with the shortest period, below the driver priority
+		 */
+		static void assign(const Order order = Order::Period, const unsigned long lowest = DEFAULT_PRIORITY,
+				const unsigned long highest = HIGHEST_PRIORITY);
+
+		/**
+		 * Check schedulability of periodic activities and log the result
+		 *
+		 * @return Whenever all the activities were measured and meet their deadlines
+		 */
+		static bool check();
+
+	private:
+		/// Time to measure the execution times for in milliseconds
+		const uint32_t warmupMs;
+
+		void run();
+
+		/**
+		 * Get assignment key of periodic activity
+		 *
+		 * @param activity Periodic activity
+		 * @param order Order of the priorities
+		 * @return Shortest period or relative deadline in ticks
+		 */
+		static TickType_t getKey(const Activity &activity, const Order order);
+
+		/**
+		 * Check whenever the activity is the first periodic activity with its key
+		 *
+		 * @param activity Periodic activity
+		 * @param order Order of the priorities
+		 * @return Whenever no activity created before has the same key
+		 */
+		static bool isFirstKey(const Activity &activity, const Order order);
+
+		/**
+		 * Get execution time bound of periodic activity
+		 *
+		 * @param activity Periodic activity
+		 * @return Measured maximal execution time plus one tick
+		 */
+		static TickType_t getExecution(const Activity &activity);
+
+		/**
+		 * Get worst case response time of periodic activity
+		 *
+		 * @param activity Periodic activity
+		 * @return Response time in ticks, the first value found above the deadline when the deadline is missed
+		 */
+		static TickType_t getResponse(const Activity &activity);
+	};
+}
+
+#endif // PRIORITY_ASSIGNMENT_H
@@ -15,8 +15,24 @@ namespace CDEECO {
 		this->receiver = receiver;
 	}
 
-	void Radio::receiveFragment(const KnowledgeFragment fragment, const uint8_t lqi) {
+	uint32_t Radio::getReceivedCount() {
+		return receivedCount;
+	}
+
+	void Radio::receiveFragment(const KnowledgeFragment &fragment, const uint8_t lqi) {
+		receivedCount++;
 		if(receiver)
 			receiver->receiveFragment(fragment, lqi);
 	}
+
+	void Radio::receivePacket(const uint8_t *data, const size_t size, const uint8_t lqi) {
+		for(size_t pos = 0; pos < size;) {
+			const size_t length = unpacked.decode(data + pos, size - pos);
+			if(length == 0)
+				return;
+
+			receiveFragment(unpacked, lqi);
+			pos += length;
+		}
+	}
 }
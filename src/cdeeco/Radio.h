@@ -44,8 +44,18 @@ namespace CDEECO {
 		 * Broadcast knowledge fragment
 		 *
 		 * To be implemented by user
+		 *
+		 * @param fragment Knowledge fragment to broadcast
+		 * @return Whenever the fragment was queued for transmission, false when it was dropped
+		 */
+		virtual bool broadcastFragment(const KnowledgeFragment &fragment) = 0;
+
+		/**
+		 * Get number of fragments received from the air
+		 *
+		 * @return Number of received fragments
 		 */
-		virtual void broadcastFragment(const KnowledgeFragment fragment) = 0;
+		uint32_t getReceivedCount();
 
 	protected:
 		/**
@@ -53,7 +63,19 @@ namespace CDEECO {
 		 *
 		 * Knowledge fragment is processed by receiver previously set by setReceiver method call.
 		 */
-		void receiveFragment(const KnowledgeFragment fragment, const uint8_t lqi);
+		void receiveFragment(const KnowledgeFragment &fragment, const uint8_t lqi);
+
+		/**
+		 * Process packet of concatenated knowledge fragments
+		 *
+		 * Each fragment is decoded from its wire encoding and passed to the receiver. Processing stops on the first
+		 * malformed fragment.
+		 *
+		 * @param data Packet data
+		 * @param size Packet size
+		 * @param lqi Link quality of the packet
+		 */
+		void receivePacket(const uint8_t *data, const size_t size, const uint8_t lqi);
 
 	private:
 		/**
@@ -62,6 +84,12 @@ namespace CDEECO {
 		 * When fragment is received this instance is used to process the knowledge fragment received.
 		 */
 		Receiver *receiver = NULL;
+
+		/// Number of received fragments
+		uint32_t receivedCount = 0;
+
+		/// Fragment decoded from the packet
+		KnowledgeFragment unpacked;
 	};
 }
 
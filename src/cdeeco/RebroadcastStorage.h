@@ -19,6 +19,8 @@
 #include "main.h"
 #include "KnowledgeFragment.h"
 #include "Broadcaster.h"
+#include "Activity.h"
+#include "StackSizes.h"
 #include "wrappers/FreeRTOSTask.h"
 #include "wrappers/FreeRTOSMutex.h"
 
@@ -33,7 +35,7 @@ namespace CDEECO {
 	 * \ingroup cdeeco
 	 */
 	template<size_t SIZE>
-	class RebroadcastStorage: FreeRTOSTask {
+	class RebroadcastStorage: Activity {
 	private:
 		/// Cache record time-stamp type
 		typedef TickType_t Timestamp;
@@ -62,7 +64,7 @@ namespace CDEECO {
 		 * @param broadcaster Instance of broadcaster used to rebroadcast packets
 		 */
 		RebroadcastStorage(Broadcaster &broadcaster) :
-				broadcaster(broadcaster) {
+				Activity(CDEECO_REBROADCAST_STACK, FreeRTOSTask::DEFAULT_PRIORITY, "Rebroad"), broadcaster(broadcaster) {
 			memset(&records, 0, sizeof(records));
 		}
 
@@ -72,7 +74,7 @@ namespace CDEECO {
 		 * @param fragment Received knowledge fragment
 		 * @param lqi Link quality for received knowledge fragment
 		 */
-		void storeFragment(const KnowledgeFragment fragment, uint8_t lqi) {
+		void storeFragment(const KnowledgeFragment &fragment, uint8_t lqi) {
 			// Stochastic Time to live implementation
 			if(gen() % STOCHASTIC_DROP_EVERY)
 				return;
@@ -88,6 +90,35 @@ namespace CDEECO {
 			const Timestamp rebroadcastDelay = 255 * RebroadcastInterval / (255 - lqi);
 
 			recordsMutex.lock();
+
+			// Skip fragment not newer than a pending copy of the same range
+			for(Index i = 0; i < records.size(); ++i) {
+				if(records[i].used && isSameRange(records[i].fragment, fragment)
+						&& !isNewerVersion(fragment.version, records[i].fragment.version)) {
+					recordsMutex.unlock();
+					return;
+				}
+			}
+
+			// Plain fragment replaces the older pending copies as it is usable without the previous data. Delta fragment
+			// is queued behind them, the receivers need each delta of the chain to reach the newer version.
+			if(!fragment.delta) {
+				bool replaced = false;
+				for(Index i = 0; i < records.size(); ++i) {
+					if(records[i].used && isSameRange(records[i].fragment, fragment)) {
+						if(!replaced)
+							records[i].fragment = fragment;
+						else
+							records[i].used = false;
+						replaced = true;
+					}
+				}
+				if(replaced) {
+					recordsMutex.unlock();
+					return;
+				}
+			}
+
 			Index free = getFree();
 			records[free].used = true;
 			records[free].received = xTaskGetTickCount();
@@ -126,30 +157,74 @@ namespace CDEECO {
 		/**
 		 * Reboradcst record
 		 *
+		 * Pending older versions of the same range are rebroadcasted first, thus the delta chain keeps its order.
+		 *
 		 * @param index Index of record to rebroadcast
 		 */
 		void rebroadcast(Index index) {
+			const KnowledgeFragment &fragment = records[index].fragment;
+			for(Index i = 0; i < records.size(); ++i)
+				if(i != index && records[i].used && isSameRange(records[i].fragment, fragment)
+						&& isNewerVersion(fragment.version, records[i].fragment.version))
+					rebroadcast(i);
+
 			console.print(Debug, ">>> Rebroadcasting fragment\n");
-			broadcaster.broadcastFragment(records[index].fragment);
+			broadcaster.broadcastFragment(fragment);
 			records[index].used = false;
 		}
 
+		/**
+		 * Rebroadcast all pending records now
+		 */
+		void flush() {
+			recordsMutex.lock();
+			for(Index i = 0; i < records.size(); ++i)
+				if(records[i].used)
+					rebroadcast(i);
+			recordsMutex.unlock();
+		}
+
 		/**
 		 * Check records and rebroadcast them every PERIOD
 		 */
 		void run() {
 			while(1) {
 				vTaskDelay(PERIOD / portTICK_PERIOD_MS);
-
-				const Timestamp now = xTaskGetTickCount();
-				recordsMutex.lock();
-				for(Index i = 0; i < records.size(); ++i)
-					if(records[i].used && records[i].rebroadcast <= now)
-						rebroadcast(i);
-				recordsMutex.unlock();
+				rebroadcastDue();
 			}
 		}
 
+		/**
+		 * Start rebroadcast job
+		 *
+		 * @return Time of the first check
+		 */
+		TickType_t start() {
+			return xTaskGetTickCount() + PERIOD / portTICK_PERIOD_MS;
+		}
+
+		/**
+		 * Check records and rebroadcast them
+		 *
+		 * @return Time of the next check
+		 */
+		TickType_t step() {
+			rebroadcastDue();
+			return xTaskGetTickCount() + PERIOD / portTICK_PERIOD_MS;
+		}
+
+		/**
+		 * Rebroadcast records due
+		 */
+		void rebroadcastDue() {
+			const Timestamp now = xTaskGetTickCount();
+			recordsMutex.lock();
+			for(Index i = 0; i < records.size(); ++i)
+				if(records[i].used && records[i].rebroadcast <= now)
+					rebroadcast(i);
+			recordsMutex.unlock();
+		}
+
 	private:
 		/// Instance of broadcaster used for rebroadcast
 		Broadcaster &broadcaster;
@@ -160,6 +235,17 @@ namespace CDEECO {
 		FreeRTOSMutex recordsMutex;
 		/// Array of cache records
 		std::array<RebroadcastStorage::ReboadcastRecord, SIZE> records;
+
+		/**
+		 * Check whenever fragments carry the same knowledge range
+		 *
+		 * @param a The first fragment
+		 * @param b The second fragment
+		 * @return True when type, id and offset match
+		 */
+		static bool isSameRange(const KnowledgeFragment &a, const KnowledgeFragment &b) {
+			return a.type == b.type && a.id == b.id && a.offset == b.offset;
+		}
 	};
 }
 
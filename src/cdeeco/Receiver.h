@@ -26,7 +26,7 @@ namespace CDEECO {
 		 * @param fragment Knowledge fragment to broadcast
 		 * @param lqi Link auality of the packet containing the fragment
 		 */
-		virtual void receiveFragment(const KnowledgeFragment fragment, uint8_t lqi) = 0;
+		virtual void receiveFragment(const KnowledgeFragment &fragment, uint8_t lqi) = 0;
 		virtual ~Receiver() {
 		}
 	};
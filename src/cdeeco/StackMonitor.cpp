@@ -0,0 +1,76 @@
+/**
+ * \ingroup cdeeco
+ * @file StackMonitor.cpp
+ *
+ * Stack usage monitor implementation
+ *
+ * \date 16. 10. 2026
+ */
+
+#include "StackMonitor.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "main.h"
+
+namespace CDEECO {
+	const StackMonitor::Kind StackMonitor::KINDS[] = {
+		{ "Component", "CDEECO_COMPONENT_STACK" },
+		{ "Periodic", "CDEECO_PERIODIC_STACK" },
+		{ "Triggered", "CDEECO_TRIGGERED_STACK" },
+		{ "Ensemble", "CDEECO_ENSEMBLE_STACK" },
+		{ "Rebroad", "CDEECO_REBROADCAST_STACK" },
+		{ "Worker", "CDEECO_WORKER_STACK" }
+	};
+
+	StackMonitor::StackMonitor(const uint32_t periodMs) :
+			FreeRTOSTask(DEFAULT_STACK_SIZE, DEFAULT_PRIORITY, "StackMon"), periodMs(periodMs) {
+	}
+
+	size_t StackMonitor::getUsage(const FreeRTOSTask &task) {
+		return task.getStackSize() - task.getStackHighWaterMark();
+	}
+
+	size_t StackMonitor::recommend(const size_t usage) {
+		const size_t margin = usage / MARGIN_DIVISOR;
+		const size_t size = usage + (margin > MIN_MARGIN ? margin : MIN_MARGIN);
+		return (size + GRANULARITY - 1) / GRANULARITY * GRANULARITY;
+	}
+
+	void StackMonitor::report() {
+		// Keep the task list unchanged while it is walked
+		vTaskSuspendAll();
+
+		console.print(Info, ">>> Stack usage in words:\n");
+		for(FreeRTOSTask *task = FreeRTOSTask::getFirst(); task != NULL; task = task->getNext()) {
+			const size_t usage = getUsage(*task);
+			console.print(Info, ">>> %-10s size %5u used %5u recommended %5u\n", task->getName(),
+					(unsigned) task->getStackSize(), (unsigned) usage, (unsigned) recommend(usage));
+		}
+
+		// Definitions fitting the largest usage of each framework task kind, kinds without tasks are kept
+		char flags[256] = "";
+		size_t length = 0;
+		for(const Kind &kind : KINDS) {
+			size_t usage = 0;
+			for(FreeRTOSTask *task = FreeRTOSTask::getFirst(); task != NULL; task = task->getNext())
+				if(strcmp(task->getName(), kind.name) == 0)
+					usage = std::max(usage, getUsage(*task));
+			if(usage > 0 && length < sizeof(flags))
+				length += snprintf(flags + length, sizeof(flags) - length, "%s-D%s=%u", length > 0 ? " " : "",
+						kind.macro, (unsigned) recommend(usage));
+		}
+		console.print(Info, ">>> Recommended STACK_FLAGS=\"%s\"\n", flags);
+
+		xTaskResumeAll();
+	}
+
+	void StackMonitor::run() {
+		while(true) {
+			vTaskDelay(periodMs / portTICK_PERIOD_MS);
+			report();
+		}
+	}
+}
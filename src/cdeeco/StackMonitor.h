@@ -0,0 +1,99 @@
+/**
+ * \ingroup cdeeco
+ * @file StackMonitor.h
+ *
+ * Stack usage monitor recommending task stack sizes
+ *
+ * \date 16. 10. 2026
+ *
+ * The monitor reads the stack high water mark of each task created by the FreeRTOS wrapper. The usage of a task is
+ * its stack size minus the high water mark, the recommended size adds a safety margin to the usage. The framework
+ * task kinds are sized by the macros in StackSizes.h, the report ends with the definitions fitting the largest usage
+ * of each kind, ready to be passed to make as STACK_FLAGS.
+ *
+ * In the calibration mode the monitor runs in its own task and logs the report periodically. Let the application go
+ * through all its states, for instance with remote nodes in and out of range, before taking the recommendation. Host
+ * stack frames are larger than the target ones, thus only target calibration gives tight sizes.
+ *
+ * Example:
+ * @code
+ * new CDEECO::StackMonitor(10000);
+ * @endcode
+ */
+
+#ifndef STACK_MONITOR_H
+#define STACK_MONITOR_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "wrappers/FreeRTOSTask.h"
+
+namespace CDEECO {
+	/**
+	 * Stack usage monitor
+	 *
+	 * \ingroup cdeeco
+	 */
+	class StackMonitor: FreeRTOSTask {
+	public:
+		/// Minimal safety margin in words
+		static const size_t MIN_MARGIN = 64;
+		/// Safety margin as a fraction of the usage
+		static const size_t MARGIN_DIVISOR = 4;
+		/// Granularity of the recommended sizes in words
+		static const size_t GRANULARITY = 16;
+
+		/**
+		 * Create monitor task logging the report periodically
+		 *
+		 * @param periodMs Report period in milliseconds
+		 */
+		StackMonitor(const uint32_t periodMs);
+
+		/**
+		 * Get stack usage of a task
+		 *
+		 * @param task Task to query
+		 * @return Maximal number of stack words used by the task so far
+		 */
+		static size_t getUsage(const FreeRTOSTask &task);
+
+		/**
+		 * Get recommended stack size
+		 *
+		 * @param usage Measured stack usage in words
+		 * @return Stack size in words covering the usage with a safety margin
+		 */
+		static size_t recommend(const size_t usage);
+
+		/**
+		 * Log stack usage of all tasks and the recommended framework stack sizes
+		 */
+		static void report();
+
+	private:
+		/**
+		 * Framework task kind sized by a macro
+		 */
+		struct Kind {
+			/// Task name
+			const char *name;
+			/// Stack size macro
+			const char *macro;
+		};
+
+		/// Framework task kinds
+		static const Kind KINDS[];
+
+		/// Report period in milliseconds
+		const uint32_t periodMs;
+
+		void run();
+	};
+}
+
+#endif // STACK_MONITOR_H
@@ -0,0 +1,49 @@
+/**
+ * \ingroup cdeeco
+ * @file StackSizes.h
+ *
+ * Stack sizes of the framework tasks
+ *
+ * \date 16. 10. 2026
+ *
+ * Stack sizes are in words of StackType_t, as passed to xTaskCreate. Each size defaults to the FreeRTOS wrapper
+ * default and can be overridden at compile time, the make variable STACK_FLAGS passes the definitions to the
+ * compiler. The StackMonitor measures the stack usage of the running tasks and logs the definitions fitting it.
+ */
+
+#ifndef STACK_SIZES_H
+#define STACK_SIZES_H
+
+#include "wrappers/FreeRTOSTask.h"
+
+/// Stack size of the component broadcast task
+#ifndef CDEECO_COMPONENT_STACK
+#define CDEECO_COMPONENT_STACK FreeRTOSTask::DEFAULT_STACK_SIZE
+#endif
+
+/// Default stack size of the periodic tasks
+#ifndef CDEECO_PERIODIC_STACK
+#define CDEECO_PERIODIC_STACK FreeRTOSTask::DEFAULT_STACK_SIZE
+#endif
+
+/// Default stack size of the triggered tasks
+#ifndef CDEECO_TRIGGERED_STACK
+#define CDEECO_TRIGGERED_STACK FreeRTOSTask::DEFAULT_STACK_SIZE
+#endif
+
+/// Stack size of the ensemble task
+#ifndef CDEECO_ENSEMBLE_STACK
+#define CDEECO_ENSEMBLE_STACK FreeRTOSTask::DEFAULT_STACK_SIZE
+#endif
+
+/// Stack size of the rebroadcast storage task
+#ifndef CDEECO_REBROADCAST_STACK
+#define CDEECO_REBROADCAST_STACK FreeRTOSTask::DEFAULT_STACK_SIZE
+#endif
+
+/// Default stack size of the executor workers
+#ifndef CDEECO_WORKER_STACK
+#define CDEECO_WORKER_STACK FreeRTOSTask::DEFAULT_STACK_SIZE
+#endif
+
+#endif // STACK_SIZES_H
@@ -16,6 +16,8 @@
 #include <algorithm>
 
 #include "RebroadcastStorage.h"
+#include "CacheRegistry.h"
+#include "DuplicateFilter.h"
 #include "KnowledgeCache.h"
 #include "Broadcaster.h"
 #include "Receiver.h"
@@ -23,28 +25,33 @@
 
 namespace CDEECO {
 	/**
-	 * CDEECo++ system class template
+	 * CDEECo++ system base class template
 	 *
 	 * \ingroup cdeeco
 	 *
-	 * This provides unified access to the radio interface.
+	 * This provides unified access to the radio interface. Received and locally broadcasted fragments are passed to
+	 * the cache registry. Received fragments seen recently are dropped before reaching the rebroadcast storage and
+	 * the caches.
 	 *
-	 * @tparam CACHES Number of cache slots in the system object
+	 * @tparam CACHES Cache registry type, either CacheSlots or CacheRegistry
 	 * @tparam REBROADCAST_SIZE Size of rebroadcast cache
 	 */
-	template <size_t CACHES = 3, size_t REBROADCAST_SIZE = 32>
-	class System: public Broadcaster, Receiver {
+	template<typename CACHES, size_t REBROADCAST_SIZE>
+	class SystemBase: public Broadcaster, Receiver {
 	public:
+		/// Number of fragments remembered by the duplicate filter
+		static const size_t DUPLICATE_FILTER_SIZE = 16;
+		/// Duplicate filter type
+		typedef DuplicateFilter<DUPLICATE_FILTER_SIZE> Filter;
+
 		/**
 		 * System constructor
 		 *
 		 * @param radio Reference to Radio implementation
+		 * @param duplicateTimeoutMs Time for which received fragments are considered duplicate, 0 disables the filter
 		 */
-		System(Radio &radio) :
-				rebroadcast(*this), radio(radio) {
-			// Erase caches
-			memset(&caches, 0, sizeof(caches));
-
+		SystemBase(Radio &radio, const uint32_t duplicateTimeoutMs) :
+				duplicates(duplicateTimeoutMs), rebroadcast(*this), radio(radio) {
 			console.print(Info, ">>> System constructor\n");
 
 			radio.setReceiver(this);
@@ -59,7 +66,7 @@ namespace CDEECO {
 		 * @param fragment Received knowledge fragment
 		 * @param lqi Link quality for received knowledge fragment
 		 */
-		void receiveFragment(const KnowledgeFragment fragment, uint8_t lqi) {
+		void receiveFragment(const KnowledgeFragment &fragment, uint8_t lqi) {
 			processFragment(fragment, lqi);
 		}
 
@@ -67,39 +74,55 @@ namespace CDEECO {
 		 * Broadcast knowledge fragment
 		 *
 		 * @param fragment Knowledge fragment to broadcast
+		 * @return Whenever the radio queued the fragment for transmission
 		 */
-		void broadcastFragment(KnowledgeFragment fragment) {
+		bool broadcastFragment(const KnowledgeFragment &fragment) {
 			console.print(Debug, ">>>>>>>>> Sending knowledge fragment:\n");
 			console.logFragment(fragment);
-			radio.broadcastFragment(fragment);
+			const bool queued = radio.broadcastFragment(fragment);
+			if(!queued)
+				console.print(Debug, ">>>>>>>>> Radio dropped the fragment\n");
+
+			// Remember own fragment in order to drop its echoes
+			duplicates.isDuplicate(fragment);
 
 			/* TODO: This is local loop-back for registering fragment from local components. Doing this makes no
 			 *  sense in real application. */
 			storeFragment(fragment);
+			return queued;
 		}
 
 		/**
-		 * Register knowledge cache
-		 *
-		 * This adds cache to fixed array of caches. When there is out of space
-		 * in the array the application is stopped on assert. Please set system
-		 * CACHES template argument properly.
+		 * Get number of fragments received from the air
 		 *
-		 * @param cache Knowledge cache to be added
+		 * @return Number of fragments received by the radio
 		 */
-		void registerCache(KnowledgeStorage *cache) {
-			assert_param(caches[caches.size() - 1] == NULL);
+		uint32_t getReceivedCount() {
+			return radio.getReceivedCount();
+		}
 
-			for(size_t i = 0; i < CACHES; ++i)
-				if(caches[i] == NULL) {
-					caches[i] = cache;
-					return;
-				}
+		/**
+		 * Get number of received fragments dropped as duplicates
+		 *
+		 * @return Duplicate filter hits
+		 */
+		uint32_t getDuplicateHits() const {
+			return duplicates.getHits();
+		}
 
-			console.print(Error, ">>>> OUT OF CACHE STORAGE <<<<\n");
-			assert_param(false);
+		/**
+		 * Get number of fragments that passed the duplicate filter
+		 *
+		 * @return Duplicate filter misses
+		 */
+		uint32_t getDuplicateMisses() const {
+			return duplicates.getMisses();
 		}
 
+	protected:
+		/// Registry of knowledge caches
+		CACHES caches;
+
 	private:
 		/**
 		 * Process process received fragment
@@ -107,10 +130,16 @@ namespace CDEECO {
 		 * @param fragment Received knowledge fragment
 		 * @param lqi Link quality for received knowledge fragment
 		 */
-		void processFragment(const KnowledgeFragment fragment, uint8_t lqi) {
+		void processFragment(const KnowledgeFragment &fragment, uint8_t lqi) {
 			console.print(Debug, ">>>>>>>>> Processing knowledge fragment:\n");
 			console.logFragment(fragment);
 
+			// Drop recently seen fragments
+			if(duplicates.isDuplicate(fragment)) {
+				console.print(Debug, ">>>>>>>>> Dropping duplicate fragment\n");
+				return;
+			}
+
 			// Store fragment in rebroadcast storage
 			rebroadcast.storeFragment(fragment, lqi);
 
@@ -122,14 +151,12 @@ namespace CDEECO {
 		 *
 		 * @param fragment Knowledge fragment to store
 		 */
-		void storeFragment(const KnowledgeFragment fragment) {
-			// Try to store fragment in one of the caches
-			for(size_t i = 0; i < caches.size() && caches[i]; ++i)
-				caches[i]->storeFragment(fragment);
+		void storeFragment(const KnowledgeFragment &fragment) {
+			caches.storeFragment(fragment);
 		}
 
-		/// Array with assigned caches
-		std::array<KnowledgeStorage*, CACHES> caches;
+		/// Filter of recently seen fragments
+		Filter duplicates;
 
 		/// Rebroadcast storage instance
 		RebroadcastStorage<REBROADCAST_SIZE> rebroadcast;
@@ -137,6 +164,85 @@ namespace CDEECO {
 		/// Radio interface instance
 		Radio &radio;
 	};
+
+	/**
+	 * CDEECo++ system class template
+	 *
+	 * \ingroup cdeeco
+	 *
+	 * System with runtime registered caches. Each fragment is offered to all registered caches.
+	 *
+	 * @tparam CACHES Number of cache slots in the system object
+	 * @tparam REBROADCAST_SIZE Size of rebroadcast cache
+	 */
+	template<size_t CACHES = 3, size_t REBROADCAST_SIZE = 32>
+	class System: public SystemBase<CacheSlots<CACHES>, REBROADCAST_SIZE> {
+	public:
+		/// Base system type
+		typedef SystemBase<CacheSlots<CACHES>, REBROADCAST_SIZE> Base;
+
+		/**
+		 * System constructor
+		 *
+		 * @param radio Reference to Radio implementation
+		 * @param duplicateTimeoutMs Time for which received fragments are considered duplicate, 0 disables the filter
+		 */
+		System(Radio &radio, const uint32_t duplicateTimeoutMs = Base::Filter::DEFAULT_TIMEOUT_MS) :
+				Base(radio, duplicateTimeoutMs) {
+		}
+
+		/**
+		 * Register knowledge cache
+		 *
+		 * This adds cache to fixed array of caches. When there is out of space
+		 * in the array the application is stopped on assert. Please set system
+		 * CACHES template argument properly.
+		 *
+		 * @param cache Knowledge cache to be added
+		 */
+		void registerCache(KnowledgeStorage *cache) {
+			this->caches.registerCache(cache);
+		}
+	};
+
+	/**
+	 * CDEECo++ system class template with compile-time cache registry
+	 *
+	 * \ingroup cdeeco
+	 *
+	 * The caches are part of the system object and are set by template arguments, thus no registration is needed and
+	 * the number of caches cannot overflow. Each fragment is passed directly to the cache of matching knowledge type.
+	 *
+	 * @tparam REBROADCAST_SIZE Size of rebroadcast cache
+	 * @tparam CACHES KnowledgeCache types, each with unique knowledge type
+	 */
+	template<size_t REBROADCAST_SIZE, typename ... CACHES>
+	class TypedSystem: public SystemBase<CacheRegistry<CACHES...>, REBROADCAST_SIZE> {
+	public:
+		/// Base system type
+		typedef SystemBase<CacheRegistry<CACHES...>, REBROADCAST_SIZE> Base;
+
+		/**
+		 * System constructor
+		 *
+		 * @param radio Reference to Radio implementation
+		 * @param duplicateTimeoutMs Time for which received fragments are considered duplicate, 0 disables the filter
+		 */
+		TypedSystem(Radio &radio, const uint32_t duplicateTimeoutMs = Base::Filter::DEFAULT_TIMEOUT_MS) :
+				Base(radio, duplicateTimeoutMs) {
+		}
+
+		/**
+		 * Get system cache for knowledge type
+		 *
+		 * @tparam TYPE Knowledge type magic
+		 * @return Reference to the cache holding knowledge of type TYPE
+		 */
+		template<Type TYPE>
+		auto &getCache() {
+			return this->caches.template getCache<TYPE>();
+		}
+	};
 }
 
 #endif // SYSTEM_H
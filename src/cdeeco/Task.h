@@ -15,6 +15,7 @@
 #include "task.h"
 
 #include <stdlib.h>
+#include <type_traits>
 
 #include "Component.h"
 
@@ -26,39 +27,70 @@ namespace CDEECO {
 	 *
 	 * This class contains common code for the standard and read-only (void output type) task.
 	 *
+	 * The task input may be restricted to a single member of the component's knowledge. Only the input member is
+	 * then copied from the component's knowledge when the task is executed.
+	 *
 	 * @tparam KNOWLEDGE Type of component's knowledge this task it part of
+	 * @tparam OUT_KNOWLEDGE Type of tasks's output knowledge
+	 * @tparam IN_KNOWLEDGE Type of tasks's input knowledge, the whole component's knowledge by default
 	 */
-	template<typename KNOWLEDGE, typename OUT_KNOWLEDGE>
+	template<typename KNOWLEDGE, typename OUT_KNOWLEDGE, typename IN_KNOWLEDGE = KNOWLEDGE>
 	class TaskBase {
 	public:
 		/**
-		 * Construct base task
+		 * Construct base task with the whole knowledge as input
 		 *
 		 * @param component Reference to task's component
 		 */
 		TaskBase(auto &component) :
-				component(component) {
+				component(component), inKnowledge(reinterpret_cast<const IN_KNOWLEDGE*>(&component.knowledge)) {
+			static_assert(std::is_same<KNOWLEDGE, IN_KNOWLEDGE>::value, "Task input knowledge has to be specified");
+		}
+
+		/**
+		 * Construct base task with knowledge member as input
+		 *
+		 * @param component Reference to task's component
+		 * @param inKnowledge Pointer to input knowledge in the component
+		 */
+		TaskBase(auto &component, const IN_KNOWLEDGE *inKnowledge) :
+				component(component), inKnowledge(inKnowledge) {
 		}
 
 		/**
 		 * Task suer code
 		 *
-		 * To be implemented by user defined task
+		 * To be implemented by user defined task. Tasks derived from SnapshotTask implement runSnapshot instead.
 		 *
 		 * @param knowledge Input copy of component's knowledge
 		 * @return Output knowledge to be written to the component's knowledge
 		 *
 		 */
-		virtual OUT_KNOWLEDGE run(const KNOWLEDGE knowledge) = 0;
+		virtual OUT_KNOWLEDGE run(const IN_KNOWLEDGE knowledge) = 0;
+
+		/**
+		 * Task user code working with the knowledge snapshot
+		 *
+		 * Called by the framework with reference to the input knowledge snapshot held by the task. The default
+		 * implementation passes a copy of the snapshot to run. To be implemented by tasks derived from SnapshotTask.
+		 *
+		 * @param snapshot Input knowledge snapshot, valid until the method returns
+		 * @return Output knowledge to be written to the component's knowledge
+		 */
+		virtual OUT_KNOWLEDGE runSnapshot(const IN_KNOWLEDGE &snapshot) {
+			return run(snapshot);
+		}
 
-		/// Default stack size for the task
-		const size_t DEFAULT_STACK_SIZE = 4096;
 		/// Default task priority
 		const unsigned long DEFAULT_PRIORITY = tskIDLE_PRIORITY + 1UL;
 
 	protected:
 		/// Reference to task's component
 		Component<KNOWLEDGE> &component;
+		/// Pointer to input knowledge in the component
+		const IN_KNOWLEDGE *inKnowledge;
+		/// Snapshot of the input knowledge the task is executed with
+		IN_KNOWLEDGE snapshot;
 		/**
 		 * Execute the task now
 		 *
@@ -76,9 +108,10 @@ namespace CDEECO {
 	 *
 	 * @tparam KNOWLEDGE Type of component's knowledge this task it part of
 	 * @tparam OUT_KNOWLEDGE Type of tasks's output knowledge
+	 * @tparam IN_KNOWLEDGE Type of tasks's input knowledge
 	 */
-	template<typename KNOWLEDGE, typename OUT_KNOWLEDGE>
-	class Task: TaskBase<KNOWLEDGE, OUT_KNOWLEDGE> {
+	template<typename KNOWLEDGE, typename OUT_KNOWLEDGE, typename IN_KNOWLEDGE = KNOWLEDGE>
+	class Task: TaskBase<KNOWLEDGE, OUT_KNOWLEDGE, IN_KNOWLEDGE> {
 	public:
 		/**
 		 * Task with output constructor
@@ -87,7 +120,18 @@ namespace CDEECO {
 		 * @param outKnowledge Reference to output knowledge in the component
 		 */
 		Task(auto &component, auto &outKnowledge) :
-				TaskBase<KNOWLEDGE, OUT_KNOWLEDGE>(component), outKnowledge(outKnowledge) {
+				TaskBase<KNOWLEDGE, OUT_KNOWLEDGE, IN_KNOWLEDGE>(component), outKnowledge(outKnowledge) {
+		}
+
+		/**
+		 * Task with output and input knowledge member constructor
+		 *
+		 * @param component Task's component reference
+		 * @param outKnowledge Reference to output knowledge in the component
+		 * @param inKnowledge Pointer to input knowledge in the component
+		 */
+		Task(auto &component, auto &outKnowledge, const IN_KNOWLEDGE *inKnowledge) :
+				TaskBase<KNOWLEDGE, OUT_KNOWLEDGE, IN_KNOWLEDGE>(component, inKnowledge), outKnowledge(outKnowledge) {
 		}
 
 	private:
@@ -102,10 +146,10 @@ namespace CDEECO {
 		 */
 		void execute() {
 			// Lock and copy input data
-			KNOWLEDGE in = this->component.lockReadKnowledge();
+			this->component.lockReadKnowledge(this->snapshot, *this->inKnowledge);
 
 			// Execute user code defined for the task
-			OUT_KNOWLEDGE out = this->run(in);
+			OUT_KNOWLEDGE out = this->runSnapshot(this->snapshot);
 
 			// Lock and copy output data
 			this->component.lockWriteKnowledge(outKnowledge, out);
@@ -118,17 +162,28 @@ namespace CDEECO {
 	 * This is task code for task that has no output (output type is void)
 	 *
 	 * @tparam KNOWLEDGE Type of component's knowledge this task it part of
+	 * @tparam IN_KNOWLEDGE Type of tasks's input knowledge
 	 */
-	template<typename KNOWLEDGE>
-	class Task<KNOWLEDGE, void> : TaskBase<KNOWLEDGE, void> {
+	template<typename KNOWLEDGE, typename IN_KNOWLEDGE>
+	class Task<KNOWLEDGE, void, IN_KNOWLEDGE> : TaskBase<KNOWLEDGE, void, IN_KNOWLEDGE> {
 	public:
 		/**
-		 * Task with output constructor
+		 * Task without output constructor
 		 *
 		 * @param component Task's component reference
 		 */
 		Task(auto &component) :
-				TaskBase<KNOWLEDGE, void>(component) {
+				TaskBase<KNOWLEDGE, void, IN_KNOWLEDGE>(component) {
+		}
+
+		/**
+		 * Task without output with input knowledge member constructor
+		 *
+		 * @param component Task's component reference
+		 * @param inKnowledge Pointer to input knowledge in the component
+		 */
+		Task(auto &component, const IN_KNOWLEDGE *inKnowledge) :
+				TaskBase<KNOWLEDGE, void, IN_KNOWLEDGE>(component, inKnowledge) {
 		}
 
 	protected:
@@ -139,10 +194,51 @@ namespace CDEECO {
 		 */
 		void execute() {
 			// Lock and copy input data
-			KNOWLEDGE in = this->component.lockReadKnowledge();
+			this->component.lockReadKnowledge(this->snapshot, *this->inKnowledge);
 
 			// Execute user code defined for the task
-			this->run(in);
+			this->runSnapshot(this->snapshot);
+		}
+	};
+
+	/**
+	 * Task implemented by the snapshot method
+	 *
+	 * \ingroup cdeeco
+	 *
+	 * Wraps any task class, the user task implements runSnapshot instead of run. The snapshot is passed by reference,
+	 * thus the knowledge is neither copied on each run nor placed on the task stack.
+	 *
+	 * Example:
+	 * @code
+	 * class Check: public CDEECO::SnapshotTask<CDEECO::PeriodicTask<Knowledge, bool>, bool, Knowledge> { ... };
+	 * @endcode
+	 *
+	 * @tparam BASE Task class to wrap
+	 * @tparam OUT_KNOWLEDGE Type of tasks's output knowledge
+	 * @tparam IN_KNOWLEDGE Type of tasks's input knowledge
+	 */
+	template<typename BASE, typename OUT_KNOWLEDGE, typename IN_KNOWLEDGE>
+	class SnapshotTask: public BASE {
+	public:
+		using BASE::BASE;
+
+		/**
+		 * Task user code working with the knowledge snapshot
+		 *
+		 * @param snapshot Input knowledge snapshot, valid until the method returns
+		 * @return Output knowledge to be written to the component's knowledge
+		 */
+		virtual OUT_KNOWLEDGE runSnapshot(const IN_KNOWLEDGE &snapshot) = 0;
+
+		/**
+		 * Pass the copy of the knowledge to the snapshot method
+		 *
+		 * @param knowledge Input copy of component's knowledge
+		 * @return Output knowledge to be written to the component's knowledge
+		 */
+		OUT_KNOWLEDGE run(const IN_KNOWLEDGE knowledge) {
+			return runSnapshot(knowledge);
 		}
 	};
 }
@@ -0,0 +1,127 @@
+/**
+ * \ingroup cdeeco
+ * @file TriggerIndex.h
+ *
+ * Index of knowledge ranges watched by triggered tasks
+ *
+ * \date 16. 10. 2026
+ *
+ * Each component keeps an index of its triggered tasks. The index holds the knowledge range watched by each task and
+ * a mask of tasks watching each knowledge block. A knowledge change is matched against the blocks it covers and then
+ * against the exact ranges of the candidate tasks, thus only the tasks watching the changed knowledge are fired.
+ */
+
+#ifndef TRIGGER_INDEX_H
+#define TRIGGER_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "main.h"
+
+namespace CDEECO {
+	/**
+	 * Interface of a task fired on knowledge change
+	 *
+	 * \ingroup cdeeco
+	 */
+	class Triggerable {
+	public:
+		/**
+		 * Fire the task
+		 *
+		 * Called when the knowledge watched by the task changes.
+		 */
+		virtual void fire() = 0;
+	};
+
+	/**
+	 * Index of triggered tasks
+	 *
+	 * @tparam KNOWLEDGE Knowledge type
+	 *
+	 * \ingroup cdeeco
+	 */
+	template<typename KNOWLEDGE>
+	class TriggerIndex {
+	public:
+		/// Mask of triggered tasks, bit i stands for i-th added task
+		typedef uint32_t Mask;
+		/// Maximal number of triggered tasks
+		static const size_t MAX_TASKS = sizeof(Mask) * 8;
+		/// Size of the knowledge block indexed by the task masks
+		static const size_t BLOCK_SIZE = 8;
+
+		/**
+		 * Add triggered task
+		 *
+		 * @param task Task to fire on change
+		 * @param start Watched range start relative to knowledge
+		 * @param size Watched range size
+		 */
+		void add(Triggerable &task, const size_t start, const size_t size) {
+			assert_param(count < MAX_TASKS);
+			assert_param(size > 0 && start + size <= sizeof(KNOWLEDGE));
+
+			tasks[count] = { &task, start, start + size };
+			for(size_t block = start / BLOCK_SIZE; block * BLOCK_SIZE < start + size; ++block)
+				blocks[block] |= (Mask) 1 << count;
+			count++;
+		}
+
+		/**
+		 * Get tasks watching the changed knowledge
+		 *
+		 * @param start Change start relative to knowledge
+		 * @param size Change size
+		 * @return Mask of tasks whose watched range overlaps the change
+		 */
+		Mask match(const size_t start, const size_t size) const {
+			const size_t end = start + size;
+
+			// Candidates watching the changed blocks
+			Mask candidates = 0;
+			for(size_t block = start / BLOCK_SIZE; block * BLOCK_SIZE < end; ++block)
+				candidates |= blocks[block];
+
+			// Keep candidates whose range overlaps the change
+			Mask matched = 0;
+			for(; candidates != 0; candidates &= candidates - 1) {
+				const size_t index = __builtin_ctz(candidates);
+				if(tasks[index].start < end && start < tasks[index].end)
+					matched |= (Mask) 1 << index;
+			}
+			return matched;
+		}
+
+		/**
+		 * Fire tasks
+		 *
+		 * @param mask Mask of tasks to fire
+		 */
+		void fire(Mask mask) {
+			for(; mask != 0; mask &= mask - 1)
+				tasks[__builtin_ctz(mask)].task->fire();
+		}
+
+	private:
+		/// Triggered task record
+		struct Record {
+			/// Task to fire
+			Triggerable *task;
+			/// Watched range start
+			size_t start;
+			/// Watched range end
+			size_t end;
+		};
+
+		/// Triggered tasks
+		Record tasks[MAX_TASKS];
+		/// Number of triggered tasks
+		size_t count = 0;
+		/// Tasks watching each knowledge block
+		Mask blocks[(sizeof(KNOWLEDGE) + BLOCK_SIZE - 1) / BLOCK_SIZE] = { };
+	};
+}
+
+#endif // TRIGGER_INDEX_H
@@ -17,7 +17,9 @@
 #include <type_traits>
 
 #include "Task.h"
-#include "ListedTriggerTask.h"
+#include "TriggerIndex.h"
+#include "Activity.h"
+#include "StackSizes.h"
 #include "Console.h"
 #include "LED.h"
 #include "wrappers/FreeRTOSSemaphore.h"
@@ -30,12 +32,16 @@ namespace CDEECO {
 	 *
 	 * Thanks to C++1y "auto" this implementation compiles even when OUT_KNOWLEDGE = void.
 	 *
+	 * Triggers coming before the task execution starts are coalesced into single execution, as the task would run
+	 * on the same latest knowledge anyway. Coalesced triggers are counted to expose task overload.
+	 *
 	 * @tparam KNOWLEDGE Type of knowledge of the component this task belongs to
 	 * @tparam TRIGGER_KNOWLEDGE Type of knowledge that triggers this task's execution
 	 * @tparam OUT_KNOWLEDGE Type of knowledge this task outputs
+	 * @tparam IN_KNOWLEDGE Type of knowledge this task reads, the whole component's knowledge by default
 	 */
-	template<typename KNOWLEDGE, typename TRIGGER_KNOWLEDGE, typename OUT_KNOWLEDGE>
-	class TriggeredTask: Task<KNOWLEDGE, OUT_KNOWLEDGE>, ListedTriggerTask, FreeRTOSTask {
+	template<typename KNOWLEDGE, typename TRIGGER_KNOWLEDGE, typename OUT_KNOWLEDGE, typename IN_KNOWLEDGE = KNOWLEDGE>
+	class TriggeredTask: Task<KNOWLEDGE, OUT_KNOWLEDGE, IN_KNOWLEDGE>, Triggerable, Activity {
 	public:
 		/**
 		 * Triggered task constructor with output knowledge
@@ -43,17 +49,17 @@ namespace CDEECO {
 		 * @param trigger Reference to trigger knowledge in the component's knowledge
 		 * @param component Reference to the component
 		 * @param outKnowledge Reference to output knowledge in the component's knowledge
-		 * @param stack Task stack size
+		 * @param stack Task stack size in words
 		 * @param priority Task priority
 		 */
 		TriggeredTask(TRIGGER_KNOWLEDGE &trigger, auto &component, auto &outKnowledge, size_t stack =
-				FreeRTOSTask::DEFAULT_STACK_SIZE, unsigned long priority = FreeRTOSTask::DEFAULT_PRIORITY) :
-				Task<KNOWLEDGE, OUT_KNOWLEDGE>(component, outKnowledge), FreeRTOSTask(stack, priority), trigger(
-						trigger), triggerSem(MAX_WAITING) {
+				CDEECO_TRIGGERED_STACK, unsigned long priority = FreeRTOSTask::DEFAULT_PRIORITY) :
+				Task<KNOWLEDGE, OUT_KNOWLEDGE, IN_KNOWLEDGE>(component, outKnowledge),
+						Activity(stack, priority, "Triggered", false), trigger(trigger) {
 			console.print(Info, ">> TrigerredTask constructor\n");
 
-			// List task in component check list
-			component.addTriggeredTask(*this);
+			// Index task in component's triggers
+			component.addTriggeredTask(*this, trigger);
 		}
 
 		/**
@@ -61,60 +67,103 @@ namespace CDEECO {
 		 *
 		 * @param trigger Reference to trigger knowledge in the component's knowledge
 		 * @param component Reference to the component
-		 * @param stack Task stack size
+		 * @param stack Task stack size in words
 		 * @param priority Task priority
 		 */
-		TriggeredTask(TRIGGER_KNOWLEDGE &trigger, auto &component, size_t stack = FreeRTOSTask::DEFAULT_STACK_SIZE,
+		TriggeredTask(TRIGGER_KNOWLEDGE &trigger, auto &component, size_t stack = CDEECO_TRIGGERED_STACK,
 				unsigned long priority = FreeRTOSTask::DEFAULT_PRIORITY) :
-				Task<KNOWLEDGE, OUT_KNOWLEDGE>(component), FreeRTOSTask(stack, priority), trigger(trigger), triggerSem(
-						MAX_WAITING) {
+				Task<KNOWLEDGE, OUT_KNOWLEDGE, IN_KNOWLEDGE>(component),
+						Activity(stack, priority, "Triggered", false), trigger(trigger) {
 			console.print(Info, ">> TrigerredTask constructor\n");
 
-			// List task in component check list
-			component.addTriggeredTask(*this);
+			// Index task in component's triggers
+			component.addTriggeredTask(*this, trigger);
 		}
 
-	protected:
 		/**
-		 * Check whenever the trigger condition is met
+		 * Triggered task constructor with output knowledge and knowledge member as input
 		 *
-		 * This automatically triggers task execution in another thread when the condition is met,
-		 * thus return is void.
+		 * @param trigger Reference to trigger knowledge in the component's knowledge
+		 * @param component Reference to the component
+		 * @param outKnowledge Reference to output knowledge in the component's knowledge
+		 * @param inKnowledge Pointer to input knowledge in the component's knowledge
+		 * @param stack Task stack size in words
+		 * @param priority Task priority
+		 */
+		TriggeredTask(TRIGGER_KNOWLEDGE &trigger, auto &component, auto &outKnowledge, const IN_KNOWLEDGE *inKnowledge,
+				size_t stack = CDEECO_TRIGGERED_STACK, unsigned long priority = FreeRTOSTask::DEFAULT_PRIORITY) :
+				Task<KNOWLEDGE, OUT_KNOWLEDGE, IN_KNOWLEDGE>(component, outKnowledge, inKnowledge), Activity(stack,
+						priority, "Triggered", false), trigger(trigger) {
+			console.print(Info, ">> TrigerredTask constructor\n");
+
+			// Index task in component's triggers
+			component.addTriggeredTask(*this, trigger);
+		}
+
+		/**
+		 * Triggered task constructor without output knowledge with knowledge member as input
 		 *
-		 * @param updateStart Pointer to start of changed area in the knowledge
-		 * @param updateEnd Pointer to the end of changed area in the knowledge
+		 * @param trigger Reference to trigger knowledge in the component's knowledge
+		 * @param component Reference to the component
+		 * @param inKnowledge Pointer to input knowledge in the component's knowledge
+		 * @param stack Task stack size in words
+		 * @param priority Task priority
 		 */
-		void checkTriggerConditionData(const void *updateStart, const void* updateEnd) {
-			// Check for trigger knowledge update
-			if(updateStart >= &trigger && updateStart < &trigger + sizeof(trigger)) {
-				triggerSem.give();
+		TriggeredTask(TRIGGER_KNOWLEDGE &trigger, auto &component, const IN_KNOWLEDGE *inKnowledge, size_t stack =
+				CDEECO_TRIGGERED_STACK, unsigned long priority = FreeRTOSTask::DEFAULT_PRIORITY) :
+				Task<KNOWLEDGE, OUT_KNOWLEDGE, IN_KNOWLEDGE>(component, inKnowledge),
+						Activity(stack, priority, "Triggered", false), trigger(trigger) {
+			console.print(Info, ">> TrigerredTask constructor\n");
+
+			// Index task in component's triggers
+			component.addTriggeredTask(*this, trigger);
+		}
+
+		/**
+		 * Get number of coalesced triggers
+		 *
+		 * @return Number of triggers that came while the task execution was already pending
+		 */
+		uint32_t getCoalescedTriggers() {
+			return coalescedTriggers;
+		}
+
+	protected:
+		/**
+		 * Trigger task execution
+		 *
+		 * Called by the component when the trigger knowledge changes. The task is executed in its own thread, the
+		 * trigger is coalesced when the execution is already pending.
+		 */
+		void fire() {
+			const bool triggered = executor != NULL ? executor->trigger(*this) : triggerSem.give();
+			if(!triggered) {
+				// Fired by concurrent knowledge writers
+				taskENTER_CRITICAL();
+				coalescedTriggers++;
+				taskEXIT_CRITICAL();
 			}
 		}
 
 	private:
 		/// Reference to trigger knowledge in the component's knowledge
 		TRIGGER_KNOWLEDGE &trigger;
-		/**
-		 *  Max triggers waiting
-		 *
-		 *  This value should not be reached. Actually the triggerSem should not have higher value than 1.
-		 *  Higher values means that triggers come faster than task executes, which is bad.
-		 */
-		const unsigned MAX_WAITING = 10000;
 		/**
 		 * Trigger semaphore
 		 *
-		 * Lowered on task execution, rise on trigger event.
+		 * Binary semaphore lowered on task execution, rise on trigger event.
 		 */
-		FreeRTOSSemaphore triggerSem;
+		FreeRTOSSemaphore triggerSem = FreeRTOSSemaphore(1, 0);
+		/// Number of triggers coalesced with the pending execution, statistics only
+		uint32_t coalescedTriggers = 0;
 
 		/**
-		 * Periodic task body implementation
+		 * Triggered task body implementation
 		 *
-		 * Responsible for periodic scheduling.
+		 * Executes the task once for each trigger event, the events coming meanwhile are coalesced.
 		 */
 		void run() {
-			// Schedule the task periodically
+			// Execute the task on triggers
 			while(1) {
 				// Wait for trigger event
 				triggerSem.take();
@@ -123,6 +172,25 @@ namespace CDEECO {
 				this->execute();
 			}
 		}
+
+		/**
+		 * Start triggered job
+		 *
+		 * @return Ignored, the task is not timed and waits for trigger
+		 */
+		TickType_t start() {
+			return 0;
+		}
+
+		/**
+		 * Run the task once
+		 *
+		 * @return Ignored, the task is not timed and waits for trigger
+		 */
+		TickType_t step() {
+			this->execute();
+			return 0;
+		}
 	};
 }
 
@@ -154,7 +154,10 @@ namespace CDEECO {
  * class that provides radio wrapper. It manages registering a
  * receiver object which will process incoming knowledge fragments. The implementation is expected to call base class
  * receiveFragment method when new data is received and implement broadcastFragment virtual method in order
- * to allow system broadcasting new data.
+ * to allow system broadcasting new data. The method returns false when the fragment is dropped, components then
+ * broadcast the range again with the next change. Radios sending the fragments over the air should send them in the compact
+ * encoding provided by KnowledgeFragment::encode and pass received packets to the base class receivePacket method
+ * which decodes them.
  *
  * ### System and caches
  * Setting up system object and caches do not require implementation of any classes. Instead the needed objects are
@@ -167,6 +170,9 @@ namespace CDEECO {
  * The cache needs to be registered with the system in order to receive data. It makes no point to create cache and not
  * to register it. It is advised to create and register all caches before starting the system by running the
  * FreeRTOS scheduler.
+ * Alternatively the caches can be passed to CDEECO::TypedSystem as template arguments. In that case the caches are part
+ * of the system object, no registration is needed and the caches are obtained by getCache method with knowledge type
+ * as template argument. Each received fragment is passed directly to the cache of matching type.
  *
  * Implementing component
  * ----------------------
@@ -201,11 +207,21 @@ namespace CDEECO {
  * The control on the breaking knowledge into packets is provided by definition of the allowed packet offsets. The user
  * is supposed to define a array which contains allowed offsets in the knowledge where packets can start. When the array is
  * empty then the packet creation is not restricted. On the other side when the array is not empty then the user is
- * responsible for definition of enough offsets to allow broadcasting of the complete knowledge. If the user fails to do so
- * runtime errors may emerge. The definition of the offsets array is performed by specialization of the
+ * responsible for definition of enough offsets to allow broadcasting of the complete knowledge. The offsets have to start
+ * at 0 and follow each other by at most CDEECO::FragmentPlan::CAPACITY bytes, otherwise the compilation fails. The
+ * definition of the offsets array is performed by specialization of the
  * CDEECO::KnowledgeTrait template for the target knowledge type. Unfortunately doing so is quite a lot of code and
- * the specialization must be part of the CDEECO name-space. When the template is not specialized a general version
- *  of the template is used. It contains empty array which means that the packets can start everywhere.
+ * the specialization must be part of the CDEECO name-space. The specialization has to be placed in the header right
+ * after the knowledge definition, so it is visible wherever the component is used. When the template is not specialized
+ * a general version of the template is used. It contains empty array which means that the packets can start everywhere.
+ * The knowledge is split into fragments by CDEECO::FragmentPlan computed at compile time from the offsets. Each
+ * fragment starts at an allowed offset and is as long as possible. Change of the knowledge is broadcasted by the
+ * planned fragments covering it.
+ * Simpler option is to describe the knowledge fields using the CDEECO_KNOWLEDGE_FIELDS and CDEECO_FIELD macros placed
+ * right after the knowledge definition outside of any name-space. The descriptors hold name, offset, size and type of
+ * each field. When no offsets are defined the fragments start at field or array element boundaries. Moreover the
+ * component detects changes per field element, thus a write broadcasts only the fields that really changed, and the
+ * knowledge cache prints the received fields decoded at the debug log level.
  * As the processes and ensembles take many template arguments and the knowledge member types are among them it is wise
  * to typedef knowledge member types in the knowledge structure.
  * For example when an ensemble which outputs the depth member of the submarine knowledge is
@@ -231,6 +247,11 @@ namespace CDEECO {
  * the output knowledge type. Then the run method will be declared as void and the base class constructor
  * will not take output knowledge reference as parameter. It may seem that it makes no sense to have tasks with no output,
  * but it may come handy when the task performs hardware control instead of pure knowledge processing.
+ * Tasks reading only a single knowledge member can declare its type as the optional last template argument and pass
+ * pointer to the member to the base class constructor after the output knowledge reference. The run method then
+ * receives constant copy of the member and only the member is copied from the component's knowledge when the task is
+ * executed. This shortens knowledge lock hold time and saves task stack. For instance the Alarm position task reads
+ * only the position member of its knowledge.
  *
  * ### Triggered task definition
  * Definition of a triggered task is very similar to the periodic task. User defined triggered task implementation
@@ -253,9 +274,9 @@ namespace CDEECO {
  * guaranteed not to work with partially updated knowledge.
  * Periodic and triggered task base class constructors have two more parameters that have default values set and are not
  * discussed in triggered task nor in periodic task description. These are used to set execution priority and stack size of
- * the task. Default values are set to FreeRTOS wrapper default stack size and priority which are
- * priority level 1 and 1024 bytes for stack. Overriding these default constructor values can be used to set different
- * priority or another stack size.
+ * the task. Default values are priority level 1 and the framework stack size of the task kind, which is the FreeRTOS
+ * wrapper default of 1024 words (4096 bytes) unless set by the STACK_FLAGS make variable. Overriding these default
+ * constructor values can be used to set different priority or another stack size.
  *
  * Implementing ensemble
  * ---------------------
@@ -275,6 +296,10 @@ namespace CDEECO {
  * possible knowledge exchange candidates. The last one is the exchange execution period. As well as in case of processes
  * an ensemble is free to store some user defined values in the ensemble class. These will not be affected by the
  * framework.
+ * The membership and mapping functions receive constant copies of the knowledge. When the knowledge is large it is
+ * better to derive the ensemble from SnapshotEnsemble and implement isMemberSnapshot, memberToCoordMapSnapshot and
+ * coordToMemberMapSnapshot instead. These receive constant references to knowledge snapshots held by the ensemble,
+ * thus the knowledge is not copied on each call and does not occupy the ensemble stack.
  *
  * Public API
  * ----------
@@ -364,7 +389,9 @@ namespace CDEECO {
  * type. Each record contains knowledge fragment data, received time-stamp, scheduled rebroadcast time-stamp and used flag.
  * When new knowledge fragment is received it is added to the storage with certain probability in order to implement
  * stochastic time-to-live. If there is no free slot in the storage the oldest record is rebroadcast and replaced by new
- * one. When new record is added a rebroadcast time-stamp is calculated based on the received link quality. The calculation
+ * one. A newer plain fragment replaces the pending copies of the same knowledge range, while a newer delta fragment is
+ * queued behind them, as the receivers need each delta of the chain. Older versions of a range are rebroadcast first.
+ * When new record is added a rebroadcast time-stamp is calculated based on the received link quality. The calculation
  * is quite simple. Rebroadcast interval is linear function of receiver link quality. Both stochastic time-to-live and
  * rebroadcast interval calculation may need further tunning to adapt real environment with more deployed nodes.
  *
@@ -381,6 +408,15 @@ namespace CDEECO {
  * data), time-stamp and complete flag. Each time new knowledge fragment of matching cache type and record id is processed
  * its data are added to the record and the availability mask is updated. When the mask covers whole knowledge than the
  * complete flag is set to true. If the cache is full then the oldest record is replaced.
+ * Each fragment carries version of the component knowledge it was taken from. The component increments the version on
+ * each knowledge change. The cache rejects fragments older than the record, so late rebroadcasted fragments cannot
+ * overwrite newer data, and fragments already stored in the record only refresh its time-stamp. Each record data change
+ * also increments the library revision, so ensembles enabled by Ensemble::setSkipUnchanged can skip records that have
+ * not changed since their last run while the local knowledge has not changed either.
+ * Components with delta encoding enabled by Component::setDeltaEncoding broadcast fragments holding only the XOR
+ * difference to the data they broadcasted previously, compressed by zero runs. The delta carries hash of the data it
+ * was computed against and the cache applies it only when the record holds matching data. Plain keyframes are
+ * broadcasted periodically so the records that missed some deltas get fixed.
  * The KnowledgeCache class inherits from two helper classes. The first one is the KnowledgeStorage class
  * which is an interface for storing fragments in the cache. It is not a template thus its type can be used to store array
  * of caches in the CDEECO::System class. Instances of this type can be used to store received fragments. The second
@@ -397,14 +433,25 @@ namespace CDEECO {
  * Knowledge is public member of component class and the class provides methods to safely read and write knowledge.
  * These are lockReadKnowledge which is used to obtain consistent copy of the knowledge and
  * lockWriteKnowledge which is used to consistently write part of the knowledge.
- * Triggered tasks are added using the component's method addTriggeredTask. It stores triggered tasks in the
- * linked list using members provided via ListedTriggerTask interface which is implemented by TriggeredTask
- * class. The root of the linked list is stored in the Component class itself. When the lockWriteKnowledge
- * method is executed and new knowledge is different from the old one then the listed tasks are consulted and those
- * affected are executed.
+ * Triggered tasks are added using the component's method addTriggeredTask together with their trigger knowledge.
+ * The component keeps them in a TriggerIndex, which holds the knowledge range watched by each task and a mask of tasks
+ * watching each 8 byte knowledge block. When the lockWriteKnowledge method is executed and new knowledge is different
+ * from the old one then the mask of tasks watching the changed fields is computed once and exactly these tasks are
+ * fired. A task is fired when the change overlaps any part of its trigger knowledge.
  * The component also owns a thread which is set to periodically broadcast complete component knowledge. Doing so is
  * important as broadcasting changed parts is not enough. Remote nodes can miss some rare updates of several knowledge
- * areas. Thus their cached knowledge will remain incomplete and unusable.
+ * areas. Thus their cached knowledge will remain incomplete and unusable. The complete knowledge does not need to be
+ * broadcasted every period though. The component tracks knowledge blocks changed and not broadcasted yet and the
+ * periods in between full refreshes, set by Component::setRefreshPeriod, broadcast only these. The broadcast period
+ * can be made adaptive by Component::setAdaptivePeriod. It then shortens while the knowledge changes, backs off
+ * exponentially while it is stable and stretches when many fragments are heard from the neighbours.
+ * Components written in bursts, for instance by an ensemble pass over many members, can set a write coalescing window
+ * by Component::setCoalescingWindow. Changes written while the window is open are broadcasted together when it closes.
+ * Components read often, or with large knowledge, can enable lock-free reads by Component::setLockFreeReads.
+ * lockReadKnowledge then copies the knowledge without the lock and retries when a write happened meanwhile, while
+ * writes stay serialized by the lock.
+ * Knowledge fragments to broadcast are prepared under the knowledge lock, but broadcasted after the lock is released.
+ * Thus knowledge readers do not wait for the radio nor for the local loop-back into the caches.
  *
  * Processes
  * ---------
@@ -429,21 +476,28 @@ namespace CDEECO {
  * The TaskBase class which is at the base of the task class hierarchy has the virtual method run. The
  * method takes constant copy of the knowledge as parameter and returns output knowledge type. The run method is not
  * implemented inside the framework as it is expected to be implemented by the user and contain task code to be executed
- * when the task runs.
+ * when the task runs. The framework actually calls the virtual method runSnapshot with a constant reference to the
+ * input knowledge snapshot held by the task. Its default implementation passes a copy of the snapshot to run. Tasks
+ * working with large knowledge can be wrapped in SnapshotTask and implement runSnapshot instead of run to avoid the
+ * copy and keep the knowledge off the task stack.
  *
  * ### Periodic task
  * Periodic task is quite simple compared to triggered task. Its only parameter is the period. The PeriodicTask
- * class also inherits from FreeRTOSThread and uses the thread to perform periodic execution of the execute
- * method provided by base task.
+ * class also inherits from Activity and uses the thread to perform periodic execution of the execute
+ * method provided by base task. Executions are released by PeriodicSchedule at absolute times, one period after the
+ * previous release, thus the execution time does not make the period drift. The schedule records activation jitter,
+ * execution time and overruns, which are available through getTimingStats. An execution finishing after the next
+ * release skips the missed releases and keeps the phase.
  *
  * ### Triggered task
  * On the other side the triggered task is more complicated. It also has internal thread which runs the base class
  * execute method. The thread lowers the semaphore and execute the task in infinite cycle. The semaphore has initial
- * value of zero. So each rise of the semaphore value causes task to execute. In order to perform check whenever the
- * watched knowledge has been changed the TriggeredTask inherits from ListedTriggerTask. Listed trigger task
- * members are used to form a linked list of triggered tasks. The list is rooted in the component and check methods are
- * executed on the whole list when the knowledge is changed. As the template function cannot be virtual the checked region
- * is passed in form of two pointers that mark the area in the knowledge structure.
+ * value of zero. So each rise of the semaphore value causes task to execute. The TriggeredTask implements the
+ * Triggerable interface and registers itself in the component's trigger index with the range of its trigger knowledge.
+ * The component matches each knowledge change against the index and calls fire only on the tasks whose trigger
+ * knowledge overlaps the change. The fire method rises the semaphore. The semaphore is binary, thus triggers coming
+ * while the execution is pending are coalesced into single execution on the latest knowledge. Coalesced triggers are
+ * counted and reported by getCoalescedTriggers, a growing count means the task cannot keep up with its trigger.
  *
  * Ensemble
  * --------
@@ -466,8 +520,53 @@ namespace CDEECO {
  * used to handle the cases where the error can occur. The resulting template code looks complicated, but the only point is
  * to mask methods that makes no sense when the particular template argument is set to void.
  * In order to run the membership tests and the knowledge exchange an ensemble inherits from the
- * FreeRTOSTask thus it contains a thread. It uses periodic scheduling to execute membership tests and
- * possibly run the knowledge exchange.
+ * Activity thus it runs in a thread. It uses periodic scheduling to execute membership tests and
+ * possibly run the knowledge exchange. Same as the periodic task it uses PeriodicSchedule and reports the timing by
+ * getTimingStats. The periodic broadcasts of the component are scheduled the same way, their timing is reported by
+ * Component::getBroadcastTimingStats.
+ *
+ * Executor
+ * --------
+ * The periodic tasks, triggered tasks, ensembles, components and the rebroadcast storage are activities. By default
+ * each activity runs in its own FreeRTOS task with its own stack, although most of the time it only waits. When an
+ * Executor is installed by Executor::setDefault before the activities are created, they run as jobs on a small pool of
+ * worker tasks instead, which saves most of the stack memory. Jobs waiting for time are kept in a timer wheel with one
+ * tick slots, jobs ready to run are kept in a queue ordered by priority. Each worker runs the ready job of the highest
+ * priority at the priority of the job, idle workers run at the highest job priority, advance the timer wheel and
+ * sleep until the earliest due job. The earliest due time is kept until its job leaves the wheel, then it is found
+ * from the bitmap of occupied slots. Triggered tasks and the write coalescing window trigger the job directly, repeated
+ * triggers are coalesced as in the task mode. Triggered jobs are not timed, they wait for the trigger only. The worker stacks have to fit the largest job stack. The radio threads stay separate tasks as they are
+ * woken from interrupts. Jobs are run-to-completion steps, thus a job takes only its object and no stack of its own.
+ * With a single worker all the activities run cooperatively on one task. The make target host-compare runs the host
+ * application with own tasks and with a single worker and prints the number of tasks, the task stack memory and the
+ * number of blocking waits of both runs.
+ *
+ * Stack sizes
+ * -----------
+ * Task stack sizes are in words of StackType_t as passed to xTaskCreate, four bytes each on the target. Each FreeRTOS
+ * wrapper task has a name and is listed in the order of creation, so the stack high water mark of every framework task
+ * can be read. The StackMonitor turns the high water marks into stack usage and recommends sizes with a safety margin
+ * of a quarter of the usage, at least 64 words. The component, periodic task, triggered task, ensemble, rebroadcast
+ * storage and executor worker stacks are sized by the macros in StackSizes.h, which default to the wrapper default.
+ * The monitor report ends with the macro definitions fitting the largest usage of each kind, to be passed to make as
+ * STACK_FLAGS. Building the target with STACK_FLAGS=-DCDEECO_STACK_CALIBRATION starts the monitor in calibration
+ * mode, logging the report every 10 seconds. The host port runs the tasks on painted thread stacks, thus the host
+ * application reports the measured usage when the scheduler ends. Host stack frames are larger than the target ones,
+ * so the host recommendations are only an upper estimate.
+ *
+ * Priority assignment
+ * -------------------
+ * Every activity is listed in the order of creation, and the periodic ones expose their PeriodicSchedule.
+ * PriorityAssignment::assign ranks the periodic tasks, ensembles and component broadcasts by period, or by the relative
+ * deadline set by Activity::setDeadline. It maps them onto the priority levels from the default priority up to the
+ * level below FreeRTOSTask::DRIVER_PRIORITY, with the shortest period at the top. The top level is reserved for the
+ * radio threads and other driver tasks woken from interrupts. When there are more distinct periods than levels,
+ * adjacent periods share a level, so the order is kept. Adaptive broadcast periods are ranked and checked by their
+ * minimal period. The assignment is logged at startup. A PriorityAssignment task
+ * waits for a warm-up time, runs the response time analysis with the measured maximal execution times and logs the
+ * response time of each activity, the utilization and the verdict. Execution times are measured in ticks, so one tick
+ * is added to each. Jobs of the same executor do not preempt each other, so the longest lower priority job is counted
+ * as blocking. Triggered tasks and the radio are not periodic and are left out of the analysis.
  *
  * System
  * ------
@@ -27,6 +27,10 @@ Console::Console(UART &serial): serial(serial) {
 void Console::init() {
 }
 
+void Console::setLevel(const Level level) {
+	Console::level = level;
+}
+
 void Console::toggleLevel() {
 	switch(level) {
 		case None:
@@ -105,8 +109,10 @@ void Console::receiveListener() {
 		// Receive header
 		fragment.type = recv<decltype(fragment.type)>();
 		fragment.id = recv<decltype(fragment.id)>();
+		fragment.version = recv<decltype(fragment.version)>();
 		fragment.size = recv<decltype(fragment.size)>();
 		fragment.offset = recv<decltype(fragment.offset)>();
+		fragment.delta = false;
 
 		// Receive data
 		for(size_t i = 0; i < fragment.size; ++i)
@@ -171,17 +177,22 @@ uint8_t Console::recvHexVal() {
 	return 0;
 }
 
-void Console::logFragment(const CDEECO::KnowledgeFragment fragment) {
+void Console::logFragment(const CDEECO::KnowledgeFragment &fragment) {
+	// Do not format fragments that would not be printed
+	if(Level::Debug < Console::level)
+		return;
+
 	// Print knowledge fragment
 	const size_t bufLen = 512;
 	char buffer[bufLen];
 
 	// Write fragment header
-	size_t written = sprintf(buffer, "Fragment:Type:%lx Id:%lx Size:%x Offset:%x", fragment.type, fragment.id,
-			fragment.size, fragment.offset);
+	size_t written = sprintf(buffer, "Fragment:Type:%lx Id:%lx Version:%lx Size:%x Offset:%x Delta:%d",
+			(unsigned long) fragment.type, (unsigned long) fragment.id, (unsigned long) fragment.version,
+			(unsigned) fragment.size, (unsigned) fragment.offset, fragment.delta);
 
 	// Write fragment data
-	for(size_t i = 0; i < fragment.length(); ++i) {
+	for(size_t i = 0; i < fragment.size; ++i) {
 		// Hex output formating
 		if(i % 16 == 0) {
 			buffer[written++] = '\n';
@@ -191,7 +202,7 @@ void Console::logFragment(const CDEECO::KnowledgeFragment fragment) {
 			buffer[written++] = ' ';
 
 		// Print single byte
-		written += sprintf(buffer + written, "%02x", ((char*) &fragment)[i]);
+		written += sprintf(buffer + written, "%02x", (uint8_t) fragment.data[i]);
 
 		// Stop printing when running out of buffer
 		if(written > bufLen - 64) {
@@ -207,6 +218,77 @@ void Console::logFragment(const CDEECO::KnowledgeFragment fragment) {
 	Console::print(Level::Debug, buffer);
 }
 
+void Console::logFields(const CDEECO::FieldDescriptor *fields, const size_t count, const void *knowledge,
+		const size_t offset, const size_t size) {
+	// Do not decode fields that would not be printed
+	if(Level::Debug < Console::level)
+		return;
+
+	for(size_t i = 0; i < count; ++i) {
+		const size_t elementSize = fields[i].elementSize();
+		for(size_t j = 0; j < fields[i].count; ++j) {
+			// Skip elements outside the range
+			const size_t start = fields[i].offset + j * elementSize;
+			if(start + elementSize <= offset || start >= offset + size)
+				continue;
+
+			print(Debug, "\t%s", fields[i].name);
+			if(fields[i].count > 1)
+				print(Debug, "[%u]", (unsigned) j);
+			print(Debug, ": ");
+			logValue(fields[i].type, (const uint8_t*) knowledge + start, elementSize);
+			print(Debug, "\n");
+		}
+	}
+}
+
+void Console::logValue(const CDEECO::FieldType type, const void *value, const size_t size) {
+	// Copy the value as the knowledge need not be aligned
+	union {
+		bool b;
+		int8_t i8;
+		int16_t i16;
+		int32_t i32;
+		uint8_t u8;
+		uint16_t u16;
+		uint32_t u32;
+		float f;
+		double d;
+	} v;
+	if(size <= sizeof(v))
+		memcpy(&v, value, size);
+
+	switch(type) {
+		case CDEECO::FieldType::Bool:
+			print(Debug, "%s", v.b ? "true" : "false");
+			return;
+		case CDEECO::FieldType::Int:
+			if(size == 1 || size == 2 || size == 4) {
+				print(Debug, "%ld", (long) (size == 1 ? v.i8 : size == 2 ? v.i16 : v.i32));
+				return;
+			}
+			break;
+		case CDEECO::FieldType::Uint:
+			if(size == 1 || size == 2 || size == 4) {
+				print(Debug, "%lu", (unsigned long) (size == 1 ? v.u8 : size == 2 ? v.u16 : v.u32));
+				return;
+			}
+			break;
+		case CDEECO::FieldType::Float:
+			if(size == sizeof(float) || size == sizeof(double)) {
+				printFloat(Debug, size == sizeof(float) ? v.f : (float) v.d);
+				return;
+			}
+			break;
+		default:
+			break;
+	}
+
+	// Print raw data and values with unsupported size as hex
+	for(size_t i = 0; i < size; ++i)
+		print(Debug, "%02x", ((const uint8_t*) value)[i]);
+}
+
 void Console::printFloat(const Level level, const float value, const int decimals) {
 	if(decimals > 0) {
 		uint32_t den = 1;
@@ -16,6 +16,7 @@
 #include <stdio.h>
 #include <stdarg.h>
 
+#include "cdeeco/KnowledgeFields.h"
 #include "cdeeco/KnowledgeFragment.h"
 #include "cdeeco/Receiver.h"
 
@@ -75,7 +76,21 @@ public:
 	 *
 	 * @param fragment Knowledge fragment to print
 	 */
-	void logFragment(const CDEECO::KnowledgeFragment fragment);
+	void logFragment(const CDEECO::KnowledgeFragment &fragment);
+
+	/**
+	 * Print decoded knowledge fields to the output
+	 *
+	 * Prints values of field elements overlapping the knowledge range.
+	 *
+	 * @param fields Knowledge field descriptors
+	 * @param count Number of field descriptors
+	 * @param knowledge Knowledge to decode values from
+	 * @param offset Range offset in the knowledge
+	 * @param size Range size
+	 */
+	void logFields(const CDEECO::FieldDescriptor *fields, const size_t count, const void *knowledge,
+			const size_t offset, const size_t size);
 
 	/**
 	 * Set receiver for knowledge fragment decoded by console
@@ -139,6 +154,15 @@ private:
 	 */
 	void receiveListener();
 
+	/**
+	 * Print single typed value
+	 *
+	 * @param type Value type
+	 * @param value Pointer to the value
+	 * @param size Value size
+	 */
+	void logValue(const CDEECO::FieldType type, const void *value, const size_t size);
+
 	/**
 	 * Receive typed data from console
 	 *
@@ -23,6 +23,8 @@
 
 #include "cdeeco/System.h"
 #include "cdeeco/KnowledgeCache.h"
+#include "cdeeco/StackMonitor.h"
+#include "cdeeco/PriorityAssignment.h"
 
 #include "test/MrfRadio.h"
 #include "test/TestComponent.h"
@@ -134,7 +136,9 @@ void userPressed(void* data) {
 void cdeecoSetup(const uint32_t uniqId) {
 	//// System setup
 	auto radio = new MrfRadio(0, uniqId, uniqId);
-	auto system = new CDEECO::System<3, 64>(*radio);
+	auto system = new CDEECO::TypedSystem<64,
+			CDEECO::KnowledgeCache<PortableSensor::Component::Type, PortableSensor::Knowledge, 10>,
+			CDEECO::KnowledgeCache<Alarm::Component::Type, Alarm::Knowledge, 10>>(*radio);
 
 	// Test component
 	new TestComponent::Component(*system, uniqId);
@@ -145,14 +149,12 @@ void cdeecoSetup(const uint32_t uniqId) {
 	auto alarm = new Alarm::Component(*system, uniqId);
 
 	// Caches
-	auto sensorCache = new CDEECO::KnowledgeCache<PortableSensor::Component::Type, PortableSensor::Knowledge, 10>();
-	auto alarmCache = new CDEECO::KnowledgeCache<Alarm::Component::Type, Alarm::Knowledge, 10>();
-	system->registerCache(sensorCache);
-	system->registerCache(alarmCache);
+	auto &sensorCache = system->getCache<PortableSensor::Component::Type>();
+	auto &alarmCache = system->getCache<Alarm::Component::Type>();
 
 	// Ensembles
-	new TempExchange::Ensemble(*alarm, *sensorCache);
-	new TempExchange::Ensemble(*sensor, *alarmCache);
+	new TempExchange::Ensemble(*alarm, sensorCache);
+	new TempExchange::Ensemble(*sensor, alarmCache);
 }
 
 /** System startup function */
@@ -215,6 +217,15 @@ int main(void) {
 	// Initialize user defined CDEECO++ system
 	cdeecoSetup(uniqId);
 
+	// Rate-monotonic priorities, schedulability checked once the execution times are measured
+	CDEECO::PriorityAssignment::assign();
+	new CDEECO::PriorityAssignment(30000);
+
+#ifdef CDEECO_STACK_CALIBRATION
+	// Log stack usage and recommended stack sizes, build with STACK_FLAGS=-DCDEECO_STACK_CALIBRATION
+	new CDEECO::StackMonitor(10000);
+#endif
+
 	// Start the scheduler.
 	console.print(Info, ">>> Running scheduler\n");
 	vTaskStartScheduler();
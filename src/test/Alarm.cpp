@@ -16,12 +16,12 @@
  */
 namespace Alarm {
 	Check::Check(auto &component) :
-			PeriodicTask(3000, component, component.knowledge.tempCritical) {
+			SnapshotTask(3000, component, component.knowledge.tempCritical) {
 	}
 
-	bool Check::run(const Knowledge in) {
+	bool Check::runSnapshot(const Knowledge &in) {
 		console.print(TaskInfo, "Alarm check task\n");
-		for(auto info : in.nearbySensors) {
+		for(const auto &info : in.nearbySensors) {
 			if(info.id != Knowledge::NO_MEMBER) {
 				console.print(TaskInfo, "> Id: %x", info.id);
 
@@ -48,18 +48,18 @@ namespace Alarm {
 		// Check temperatures for dangerous conditions
 		const float threshold = 26.0f;
 
-		for(auto info : in.nearbySensors)
+		for(const auto &info : in.nearbySensors)
 			if(info.value.temperature > threshold)
 				return true;
 		return false;
 	}
 
 	Critical::Critical(auto &component) :
-			TriggeredTask(component.knowledge.tempCritical, component) {
+			TriggeredTask(component.knowledge.tempCritical, component, &component.knowledge.tempCritical) {
 	}
 
-	void Critical::run(const Knowledge in) {
-		if(in.tempCritical) {
+	void Critical::run(const bool critical) {
+		if(critical) {
 			console.print(TaskInfo, "##############################################################\n");
 			console.print(TaskInfo, "# Critical task triggered on change and temp is CRITICAL !!! #\n");
 			console.print(TaskInfo, "##############################################################\n");
@@ -71,10 +71,10 @@ namespace Alarm {
 	}
 
 	Position::Position(auto &component) :
-			PeriodicTask(1259, component, component.knowledge.position) {
+			PeriodicTask(1259, component, component.knowledge.position, &component.knowledge.position) {
 	}
 
-	Knowledge::Position Position::run(const Knowledge in) {
+	Knowledge::Position Position::run(const Knowledge::Position in) {
 		GPSL10::GPSFix fix = gps.getGPSFix();
 
 		console.print(TaskInfo, "Position task:\n");
@@ -88,7 +88,7 @@ namespace Alarm {
 		if(fix.valid)
 			return {fix.latitude, fix.longitude};
 		else
-			return in.position;
+			return in;
 	}
 
 	Component::Component(CDEECO::Broadcaster &broadcaster, const CDEECO::Id id) :
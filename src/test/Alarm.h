@@ -14,9 +14,10 @@
 
 #include <array>
 #include <algorithm>
-#include <climits>
+#include <cstdint>
 
 #include "cdeeco/Component.h"
+#include "cdeeco/KnowledgeFields.h"
 #include "cdeeco/PeriodicTask.h"
 #include "cdeeco/TriggeredTask.h"
 
@@ -41,7 +42,7 @@ namespace Alarm {
 		} position;
 
 		/// Id valued used to signal no id
-		static const CDEECO::Id NO_MEMBER = ULONG_MAX;
+		static const CDEECO::Id NO_MEMBER = UINT32_MAX;
 
 		/// Information about single sensor
 		struct SensorInfo {
@@ -59,13 +60,23 @@ namespace Alarm {
 		// Whenever nearby sensor temperature reached critical
 		bool tempCritical;
 	};
+}
+
+/// Knowledge fields
+CDEECO_KNOWLEDGE_FIELDS(Alarm::Knowledge,
+		CDEECO_FIELD(position.lat),
+		CDEECO_FIELD(position.lon),
+		CDEECO_FIELD(nearbySensors),
+		CDEECO_FIELD(tempCritical))
+
+namespace Alarm {
 
 	/**
 	 * Temperature check task
 	 *
 	 * \ingroup example
 	 */
-	class Check: public CDEECO::PeriodicTask<Knowledge, bool> {
+	class Check: public CDEECO::SnapshotTask<CDEECO::PeriodicTask<Knowledge, bool>, bool, Knowledge> {
 	public:
 		/**
 		 * Temperature check task constructor
@@ -78,10 +89,10 @@ namespace Alarm {
 		/**
 		 * Temperature check task code
 		 *
-		 * @param in Copy of Alarm knowledge
+		 * @param in Snapshot of Alarm knowledge
 		 * @return Whenever temperature is critical (written to components knowledge)
 		 */
-		bool run(const Knowledge in);
+		bool runSnapshot(const Knowledge &in);
 	};
 
 	/**
@@ -89,7 +100,7 @@ namespace Alarm {
 	 *
 	 * \ingroup example
 	 */
-	class Critical: public CDEECO::TriggeredTask<Knowledge, bool, void> {
+	class Critical: public CDEECO::TriggeredTask<Knowledge, bool, void, bool> {
 	public:
 		/**
 		 * Critical trigger task constructor
@@ -101,12 +112,13 @@ namespace Alarm {
 		/**
 		 * Critical triggered task code
 		 *
-		 * Executed on tempCritical knowledge member change. Output type declared as void -> has no output.
+		 * Executed on tempCritical knowledge member change. Output type declared as void -> has no output. Input
+		 * type declared as bool -> reads only the tempCritical knowledge member.
 		 *
-		 * @param in Copy of Alarm component's knowledge
+		 * @param critical Copy of Alarm component's tempCritical knowledge
 		 *
 		 */
-		void run(const Knowledge in);
+		void run(const bool critical);
 	};
 
 	/**
@@ -114,7 +126,7 @@ namespace Alarm {
 	 *
 	 * \ingroup example
 	 */
-	class Position: public CDEECO::PeriodicTask<Knowledge, Knowledge::Position> {
+	class Position: public CDEECO::PeriodicTask<Knowledge, Knowledge::Position, Knowledge::Position> {
 	public:
 		/**
 		 * Position task constructor
@@ -127,10 +139,10 @@ namespace Alarm {
 		/**
 		 * Position task code
 		 *
-		 * @param in Copy of component's knowledge
+		 * @param in Copy of component's position knowledge
 		 * @return New position (task output)
 		 */
-		Knowledge::Position run(const Knowledge in);
+		Knowledge::Position run(const Knowledge::Position in);
 	};
 
 	/**
@@ -22,8 +22,8 @@ MrfRadio::MrfRadio(uint8_t channel, uint16_t panId, uint16_t sourceAddress) {
 	mrf.reset();
 }
 
-void MrfRadio::broadcastFragment(const CDEECO::KnowledgeFragment fragment) {
-	txBuffer.put(fragment);
+bool MrfRadio::broadcastFragment(const CDEECO::KnowledgeFragment &fragment) {
+	return txBuffer.put(fragment);
 }
 
 void MrfRadio::broadcastCompleteListenerStatic(void *data, const bool success) {
@@ -39,29 +39,63 @@ void MrfRadio::receiverListenerStatic(void *data) {
 }
 
 void MrfRadio::receiveListener() {
-	Packet packet;
-	packet.valid = mrf.recvPacket(packet.data.data, packet.size, packet.srcPanId, packet.srcSAddr, packet.fcs,
-			packet.lqi, packet.rssi);
-	if(packet.valid)
-		rxBuffer.put(packet);
+	// Receive packet directly into the buffer, drop it when the buffer is full
+	Packet *packet = rxBuffer.acquire();
+	if(packet == NULL) {
+		mrf.recvPacket(dropPacket.data, dropPacket.size, dropPacket.srcPanId, dropPacket.srcSAddr, dropPacket.fcs,
+				dropPacket.lqi, dropPacket.rssi);
+		return;
+	}
+
+	packet->valid = mrf.recvPacket(packet->data, packet->size, packet->srcPanId, packet->srcSAddr, packet->fcs,
+			packet->lqi, packet->rssi);
+	if(packet->valid)
+		rxBuffer.commit();
 }
 
 void MrfRadio::RxThread::run() {
 	console.print(Info, ">>>> Radio RX thread started\n");
 	while(true) {
-		Packet packet = radio.rxBuffer.get();
-		if(packet.valid && packet.data.fragment.length() == packet.size)
-			radio.receiveFragment(packet.data.fragment, packet.lqi);
+		const Packet &packet = radio.rxBuffer.get();
+		if(packet.valid)
+			radio.receivePacket(packet.data, packet.size, packet.lqi);
+		radio.rxBuffer.release();
 	}
 }
 
 void MrfRadio::TxThread::run() {
 	console.print(Info, ">>>> Radio TX thread started\n");
+	// Fragment obtained from the buffer that did not fit the previous frame
+	CDEECO::KnowledgeFragment *pending = NULL;
 	while(true) {
-		CDEECO::KnowledgeFragment fragment = radio.txBuffer.get();
+		if(pending == NULL)
+			pending = &radio.txBuffer.get();
+
+		// Start frame with the first fragment, fragments are sized to fit a frame on their own
+		assert_param(pending->length() <= MAX_FRAME_PAYLOAD);
+		size_t frameSize = pending->encode(radio.txFrame);
+		radio.txBuffer.release();
+		pending = NULL;
+
+		// Append fragments that arrive before the flush deadline while they fit the frame
+		const TickType_t deadline = xTaskGetTickCount() + FLUSH_DEADLINE_MS / portTICK_PERIOD_MS;
+		while(frameSize < MAX_FRAME_PAYLOAD) {
+			const TickType_t remaining = deadline - xTaskGetTickCount();
+			if((int32_t) remaining < 0)
+				break;
+
+			pending = radio.txBuffer.get(remaining * portTICK_PERIOD_MS);
+			if(pending == NULL || frameSize + pending->length() > MAX_FRAME_PAYLOAD)
+				break;
+
+			frameSize += pending->encode(radio.txFrame + frameSize);
+			radio.txBuffer.release();
+			pending = NULL;
+		}
+
 		radio.txSem.take();
 		taskDISABLE_INTERRUPTS();
-		mrf.broadcastPacket((uint8_t*) &fragment, (uint8_t) fragment.length());
+		mrf.broadcastPacket(radio.txFrame, (uint8_t) frameSize);
 		taskENABLE_INTERRUPTS();
 	}
 }
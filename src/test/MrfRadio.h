@@ -20,10 +20,19 @@
 /**
  * Simple radio interface provider implementation
  *
+ * Fragments pending for transmission are packed into a single frame. The transmit thread waits at most
+ * FLUSH_DEADLINE_MS after the first fragment for more fragments and appends them while they fit the frame payload.
+ * Fragments are sent in their wire encoding one after another.
+ *
  * \ingroup example
  */
 class MrfRadio: public CDEECO::Radio {
 public:
+	/// Maximal frame payload, 127 bytes of PHY frame without 7 bytes of MAC header and 2 bytes of FCS
+	static const size_t MAX_FRAME_PAYLOAD = CDEECO::KnowledgeFragment::MAX_FRAME_PAYLOAD;
+	/// Maximal time to wait for more fragments to be packed into a frame
+	static const uint32_t FLUSH_DEADLINE_MS = 5;
+
 	/**
 	 * Radio constructor
 	 *
@@ -36,14 +45,23 @@ public:
 	/**
 	 * Broadcast fragment
 	 *
+	 * The fragment is dropped when the transmit buffer is full.
+	 *
 	 * @param fragment Fragment to broadcast
+	 * @return Whenever the fragment was put to the transmit buffer
 	 */
-	void broadcastFragment(const CDEECO::KnowledgeFragment fragment);
+	bool broadcastFragment(const CDEECO::KnowledgeFragment &fragment);
 
 private:
 	/**
 	 * Ultra simple ring buffer
 	 *
+	 * Items are read in place, the consumer obtains the oldest committed slot, processes it and releases it. There is
+	 * a single consumer. Producers put copies of the items, each copy is stored in a single critical section, thus
+	 * several producers may put items at the same time. A buffer with a single producer may write items in place
+	 * instead, the producer acquires a free slot, fills it and commits it. When the buffer is full new items are
+	 * dropped.
+	 *
 	 * @tparam T Buffer content type
 	 * @tparam SIZE Buffer size
 	 */
@@ -51,30 +69,82 @@ private:
 	class RingBuffer {
 	public:
 		/**
-		 * Put item into buffer
+		 * Acquire free slot to be filled by the producer
 		 *
-		 * This do not block and overwrites items in the full buffer
+		 * This do not block. Only for buffers with a single producer, which does not use put.
+		 *
+		 * @return Pointer to free slot or NULL when the buffer is full
+		 */
+		T *acquire() {
+			taskENTER_CRITICAL();
+			T *slot = start - end < SIZE ? &data[start % SIZE] : NULL;
+			taskEXIT_CRITICAL();
+			return slot;
+		}
+
+		/**
+		 * Commit previously acquired slot
 		 */
-		void put(const T &item) {
+		void commit() {
 			taskENTER_CRITICAL();
-			data[start++ % SIZE] = item;
+			start++;
 			taskEXIT_CRITICAL();
 			sem.giveFromISR();
 		}
 
 		/**
-		 * Retrieve item from buffer
+		 * Put copy of item into buffer
 		 *
-		 * This may block if buffer is empty
+		 * This do not block and drops the item when the buffer is full.
 		 *
-		 * @return Retrieved item
+		 * @param item Item to put
+		 * @return Whenever the item was stored
 		 */
-		T get() {
+		bool put(const T &item) {
+			taskENTER_CRITICAL();
+			const bool stored = start - end < SIZE;
+			if(stored)
+				data[start++ % SIZE] = item;
+			taskEXIT_CRITICAL();
+			if(stored)
+				sem.giveFromISR();
+			return stored;
+		}
+
+		/**
+		 * Obtain oldest committed slot
+		 *
+		 * This may block if buffer is empty. The slot is valid until release is called.
+		 *
+		 * @return Reference to the oldest item
+		 */
+		T &get() {
 			sem.take();
+			return data[end % SIZE];
+		}
+
+		/**
+		 * Obtain oldest committed slot with timeout
+		 *
+		 * This may block at most for the specified time if buffer is empty. The slot is valid until release is
+		 * called.
+		 *
+		 * @param timeoutMs Maximal time to wait in milliseconds
+		 * @return Pointer to the oldest item or NULL on timeout
+		 */
+		T *get(const uint32_t timeoutMs) {
+			if(!sem.take(timeoutMs))
+				return NULL;
+			return &data[end % SIZE];
+		}
+
+		/**
+		 * Release slot obtained by get
+		 */
+		void release() {
 			taskENTER_CRITICAL();
-			T ret = data[end++ % SIZE];
+			end++;
 			taskEXIT_CRITICAL();
-			return ret;
 		}
 
 	private:
@@ -95,16 +165,8 @@ private:
 	 * Radio packet wrapper
 	 */
 	struct Packet {
-		/**
-		 * Packed data represented as union in order to be accessible as plain data and
-		 * KnowledgeFragment at the same time.
-		 */
-		union {
-			/// Plain data packet access
-			uint8_t data[CDEECO::KnowledgeFragment::MAX_PACKET_SIZE];
-			/// Access data as KnowledgeFragment
-			CDEECO::KnowledgeFragment fragment;
-		} data;
+		/// Packet data holding encoded knowledge fragments
+		uint8_t data[CDEECO::KnowledgeFragment::MAX_PACKET_SIZE];
 
 		/// Packet size
 		uint8_t size;
@@ -128,8 +190,12 @@ private:
 	RingBuffer<CDEECO::KnowledgeFragment, 5> txBuffer;
 	/// Receive ring buffer
 	RingBuffer<Packet, 5> rxBuffer;
+	/// Packet used to drain the radio when the receive buffer is full
+	Packet dropPacket;
 	/// Transmit control semaphore
 	FreeRTOSSemaphore txSem = FreeRTOSSemaphore(1000, 1);
+	/// Frame being packed by the transmit thread
+	uint8_t txFrame[CDEECO::KnowledgeFragment::MAX_PACKET_SIZE];
 
 	/**
 	 * Receiving thread
@@ -137,7 +203,7 @@ private:
 	class RxThread: FreeRTOSTask {
 		friend MrfRadio;
 		RxThread(MrfRadio &radio) :
-				radio(radio) {
+				FreeRTOSTask(DEFAULT_STACK_SIZE, DRIVER_PRIORITY, "MrfRx"), radio(radio) {
 		}
 		void run();
 		MrfRadio &radio;
@@ -149,7 +215,7 @@ private:
 	class TxThread: FreeRTOSTask {
 		friend MrfRadio;
 		TxThread(MrfRadio &radio) :
-				FreeRTOSTask(1024, 2), radio(radio) {
+				FreeRTOSTask(1024, DRIVER_PRIORITY, "MrfTx"), radio(radio) {
 		}
 		void run();
 		MrfRadio &radio;
@@ -61,14 +61,3 @@ namespace PortableSensor {
 		memset(&knowledge, 0, sizeof(Knowledge));
 	}
 }
-
-namespace CDEECO {
-	/// Allowed offsets to guarantee knowledge consistency
-	template<>
-	struct KnowledgeTrait<PortableSensor::Knowledge> {
-		static constexpr std::array<size_t, 1> offsets = { { offsetof(PortableSensor::Knowledge, position) } };
-	};
-	// This declaration do not require array size to be specified twice, but drives eclipse crazy.
-	//constexpr decltype(KnowledgeTrait<TestKnowledge>::offsets) KnowledgeTrait<TestKnowledge>::offsets;
-	constexpr std::array<size_t, 1> KnowledgeTrait<PortableSensor::Knowledge>::offsets;
-}
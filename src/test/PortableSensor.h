@@ -15,10 +15,12 @@
 #define PORTABLE_SENSOR
 
 #include <array>
+#include <cstddef>
 #include <random>
-#include <climits>
+#include <cstdint>
 
 #include "cdeeco/Component.h"
+#include "cdeeco/KnowledgeFields.h"
 #include "cdeeco/PeriodicTask.h"
 #include "drivers/SHT1x.h"
 
@@ -43,7 +45,7 @@ namespace PortableSensor {
 		/// Coordinator identification
 		typedef CDEECO::Id CoordId;
 		/// Coordinator value meaning there is no coordinator
-		static const CoordId NO_COORD = ULONG_MAX;
+		static const CoordId NO_COORD = UINT32_MAX;
 		/// Sensor's coordinator
 		CoordId coordId;
 
@@ -53,6 +55,17 @@ namespace PortableSensor {
 			float humidity;
 		} value;
 	};
+}
+
+/// Knowledge fields
+CDEECO_KNOWLEDGE_FIELDS(PortableSensor::Knowledge,
+		CDEECO_FIELD(position.lat),
+		CDEECO_FIELD(position.lon),
+		CDEECO_FIELD(coordId),
+		CDEECO_FIELD(value.temperature),
+		CDEECO_FIELD(value.humidity))
+
+namespace PortableSensor {
 
 	/**
 	 * Sensor value gather task
@@ -21,8 +21,8 @@ namespace TempExchange {
 			EnsembleType(&member, &member.knowledge.coordId, &library, PERIOD_MS) {
 	}
 
-	bool Ensemble::isMember(const CDEECO::Id coordId, const Alarm::Knowledge coordKnowledge, const CDEECO::Id memeberId,
-			const PortableSensor::Knowledge memberKnowledge) {
+	bool Ensemble::isMemberSnapshot(const CDEECO::Id coordId, const Alarm::Knowledge &coordKnowledge,
+			const CDEECO::Id memeberId, const PortableSensor::Knowledge &memberKnowledge) {
 		// For debugging purposes we consider all sensors are members
 		return true;
 
@@ -31,8 +31,8 @@ namespace TempExchange {
 		//		&& (int) (coordKnowledge.position.lon) == (int) (memberKnowledge.position.lon);
 	}
 
-	Alarm::Knowledge::SensorData Ensemble::memberToCoordMap(const Alarm::Knowledge coord, const CDEECO::Id memberId,
-			const PortableSensor::Knowledge memberKnowledge) {
+	Alarm::Knowledge::SensorData Ensemble::memberToCoordMapSnapshot(const Alarm::Knowledge &coord,
+			const CDEECO::Id memberId, const PortableSensor::Knowledge &memberKnowledge) {
 		auto values = coord.nearbySensors;
 
 		// Try to update record
@@ -64,8 +64,8 @@ namespace TempExchange {
 		return values;
 	}
 
-	PortableSensor::Knowledge::CoordId Ensemble::coordToMemberMap(const PortableSensor::Knowledge member,
-			const CDEECO::Id coordId, const Alarm::Knowledge coordKnowledge) {
+	PortableSensor::Knowledge::CoordId Ensemble::coordToMemberMapSnapshot(const PortableSensor::Knowledge &member,
+			const CDEECO::Id coordId, const Alarm::Knowledge &coordKnowledge) {
 		return coordId;
 	}
 }
@@ -28,7 +28,7 @@
  */
 namespace TempExchange {
 	/// Base Ensemble type definition
-	typedef CDEECO::Ensemble<Alarm::Knowledge, Alarm::Knowledge::SensorData, PortableSensor::Knowledge,
+	typedef CDEECO::SnapshotEnsemble<Alarm::Knowledge, Alarm::Knowledge::SensorData, PortableSensor::Knowledge,
 			PortableSensor::Knowledge::CoordId> EnsembleType;
 
 	/**
@@ -68,8 +68,8 @@ namespace TempExchange {
 		 *
 		 * @return Whenever the supplied member and coordinator belong to the ensemble
 		 */
-		bool isMember(const CDEECO::Id coordId, const Alarm::Knowledge coordKnowledge, const CDEECO::Id memberId,
-				const PortableSensor::Knowledge memberKnowledge);
+		bool isMemberSnapshot(const CDEECO::Id coordId, const Alarm::Knowledge &coordKnowledge,
+				const CDEECO::Id memberId, const PortableSensor::Knowledge &memberKnowledge);
 
 		/**
 		 *  Map temperatures from Thermometers to Alarm
@@ -79,8 +79,8 @@ namespace TempExchange {
 		 *  @param memberKnowledge Member knowledge
 		 *  @return Sensor data array (ensemble output)
 		 */
-		Alarm::Knowledge::SensorData memberToCoordMap(const Alarm::Knowledge coord, const CDEECO::Id memberId,
-				const PortableSensor::Knowledge memberKnowledge);
+		Alarm::Knowledge::SensorData memberToCoordMapSnapshot(const Alarm::Knowledge &coord, const CDEECO::Id memberId,
+				const PortableSensor::Knowledge &memberKnowledge);
 
 		/**
 		 * Map data from Alarm to Thermometer
@@ -90,8 +90,8 @@ namespace TempExchange {
 		 * @param coordKnowledge Coordinator knowledge
 		 * @return Coordinator id (ensemble output)
 		 */
-		PortableSensor::Knowledge::CoordId coordToMemberMap(const PortableSensor::Knowledge member,
-				const CDEECO::Id coordId, const Alarm::Knowledge coordKnowledge);
+		PortableSensor::Knowledge::CoordId coordToMemberMapSnapshot(const PortableSensor::Knowledge &member,
+				const CDEECO::Id coordId, const Alarm::Knowledge &coordKnowledge);
 
 	private:
 		/**
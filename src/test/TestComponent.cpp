@@ -40,15 +40,3 @@ namespace TestComponent {
 		memset(&knowledge, 0, sizeof(Knowledge));
 	}
 }
-
-namespace CDEECO {
-	/// Define allowed offsets to guarantee knowledge consistency
-	template<>
-	struct KnowledgeTrait<Knowledge> {
-		static constexpr std::array<size_t, 2> offsets = { { offsetof(TestComponent::Knowledge, normVal), offsetof(
-				TestComponent::Knowledge, trigVal) } };
-	};
-	// This declaration do not require array size to be specified twice, but drives eclipse crazy.
-	//constexpr decltype(KnowledgeTrait<TestKnowledge>::offsets) KnowledgeTrait<TestKnowledge>::offsets;
-	constexpr std::array<size_t, 2> KnowledgeTrait<Knowledge>::offsets;
-}
@@ -18,8 +18,10 @@
 #define TESTCOMPONENT_H
 
 #include <array>
+#include <cstddef>
 
 #include "cdeeco/Component.h"
+#include "cdeeco/KnowledgeFields.h"
 #include "cdeeco/Knowledge.h"
 #include "cdeeco/PeriodicTask.h"
 #include "cdeeco/TriggeredTask.h"
@@ -43,6 +45,14 @@ namespace TestComponent {
 		NormValue normVal;
 		TrigValue trigVal;
 	};
+}
+
+/// Knowledge fields
+CDEECO_KNOWLEDGE_FIELDS(TestComponent::Knowledge,
+		CDEECO_FIELD(normVal),
+		CDEECO_FIELD(trigVal))
+
+namespace TestComponent {
 
 	/**
 	 * Test component periodic task
@@ -23,8 +23,12 @@ void FreeRTOSSemaphore::take() {
 	xSemaphoreTake(sem, portMAX_DELAY);
 }
 
-void FreeRTOSSemaphore::give() {
-	xSemaphoreGive(sem);
+bool FreeRTOSSemaphore::take(const uint32_t timeoutMs) {
+	return xSemaphoreTake(sem, timeoutMs / portTICK_PERIOD_MS) == pdTRUE;
+}
+
+bool FreeRTOSSemaphore::give() {
+	return xSemaphoreGive(sem) == pdTRUE;
 }
 
 void FreeRTOSSemaphore::giveFromISR() {
@@ -41,12 +41,24 @@ public:
 	 */
 	void take();
 
+	/**
+	 * Take semaphore with timeout
+	 *
+	 * This will block at most for the specified time if the semaphore is at 0.
+	 *
+	 * @param timeoutMs Maximal time to wait in milliseconds
+	 * @return Whenever the semaphore was taken
+	 */
+	bool take(const uint32_t timeoutMs);
+
 	/**
 	 * Give semaphore
 	 *
-	 * This will block if the semaphore already at maximum value.
+	 * This does nothing if the semaphore is already at maximum value.
+	 *
+	 * @return Whenever the semaphore was given
 	 */
-	void give();
+	bool give();
 
 	/**
 	 * Give semaphore from ISR
@@ -13,12 +13,30 @@
 
 #include "FreeRTOSTask.h"
 
-FreeRTOSTask::FreeRTOSTask(size_t stackSize, unsigned long priority) {
-	xTaskCreate(taskBody, "Task", stackSize, this, tskIDLE_PRIORITY + priority, &handle);
+FreeRTOSTask *FreeRTOSTask::first = NULL;
+
+FreeRTOSTask::FreeRTOSTask(size_t stackSize, unsigned long priority, const char *name) :
+		name(name), stackSize(stackSize) {
+	// Append to the list of tasks
+	taskENTER_CRITICAL();
+	FreeRTOSTask **position = &first;
+	while(*position != NULL)
+		position = &(*position)->next;
+	*position = this;
+	taskEXIT_CRITICAL();
+
+	xTaskCreate(taskBody, name, stackSize, this, tskIDLE_PRIORITY + priority, &handle);
 }
 
 FreeRTOSTask::~FreeRTOSTask() {
 	vTaskDelete(handle);
+
+	taskENTER_CRITICAL();
+	FreeRTOSTask **position = &first;
+	while(*position != this)
+		position = &(*position)->next;
+	*position = next;
+	taskEXIT_CRITICAL();
 }
 
 void FreeRTOSTask::mDelay(uint16_t ms) {
@@ -28,6 +46,31 @@ void FreeRTOSTask::mDelay(uint16_t ms) {
 void FreeRTOSTask::suspend() {
 	vTaskSuspend(handle);
 }
+
+void FreeRTOSTask::setPriority(unsigned long priority) {
+	vTaskPrioritySet(handle, tskIDLE_PRIORITY + priority);
+}
+
+const char *FreeRTOSTask::getName() const {
+	return name;
+}
+
+size_t FreeRTOSTask::getStackSize() const {
+	return stackSize;
+}
+
+size_t FreeRTOSTask::getStackHighWaterMark() const {
+	return uxTaskGetStackHighWaterMark(handle);
+}
+
+FreeRTOSTask *FreeRTOSTask::getFirst() {
+	return first;
+}
+
+FreeRTOSTask *FreeRTOSTask::getNext() const {
+	return next;
+}
+
 void FreeRTOSTask::taskBody(void *data) {
 	static_cast<FreeRTOSTask*>(data)->run();
 }
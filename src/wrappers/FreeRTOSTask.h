@@ -31,18 +31,22 @@
  */
 class FreeRTOSTask {
 public:
-	/// Default task stack size in bytes
+	/// Default task stack size in words of StackType_t, 4 bytes each on the target
 	static const size_t DEFAULT_STACK_SIZE = 1024;
 	/// Default task priority
 	static const unsigned long DEFAULT_PRIORITY = 1UL;
+	/// Priority of the driver tasks woken from interrupts, the top level is reserved for them
+	static const unsigned long DRIVER_PRIORITY = configMAX_PRIORITIES - 1 - tskIDLE_PRIORITY;
 
 	/**
 	 * Create FreeRTOStask
 	 *
-	 * @param stackSize Task stack size
+	 * @param stackSize Task stack size in words
 	 * @param priority Task priority
+	 * @param name Task name, shorter than configMAX_TASK_NAME_LEN, identifies the task in stack usage reports
 	 */
-	FreeRTOSTask(size_t stackSize = DEFAULT_STACK_SIZE, unsigned long priority = DEFAULT_PRIORITY);
+	FreeRTOSTask(size_t stackSize = DEFAULT_STACK_SIZE, unsigned long priority = DEFAULT_PRIORITY,
+			const char *name = "Task");
 
 	/**
 	 * Destroy task
@@ -72,9 +76,63 @@ public:
 	 */
 	void suspend();
 
+	/**
+	 * Set task priority
+	 *
+	 * @param priority Task priority
+	 */
+	void setPriority(unsigned long priority);
+
+	/**
+	 * Get task name
+	 *
+	 * @return Task name
+	 */
+	const char *getName() const;
+
+	/**
+	 * Get task stack size
+	 *
+	 * @return Stack size in words
+	 */
+	size_t getStackSize() const;
+
+	/**
+	 * Get stack high water mark
+	 *
+	 * @return Minimal amount of stack words left unused since the task was started
+	 */
+	size_t getStackHighWaterMark() const;
+
+	/**
+	 * Get first created task
+	 *
+	 * Tasks are listed in the order of creation. Iterate from within a critical section when tasks may be created or
+	 * destroyed concurrently.
+	 *
+	 * @return First task, NULL when there is none
+	 */
+	static FreeRTOSTask *getFirst();
+
+	/**
+	 * Get next created task
+	 *
+	 * @return Next task, NULL for the last one
+	 */
+	FreeRTOSTask *getNext() const;
+
 private:
+	/// First created task
+	static FreeRTOSTask *first;
+
 	/// Task handle used by FreeRTOS
 	TaskHandle_t handle;
+	/// Task name
+	const char * const name;
+	/// Task stack size in words
+	const size_t stackSize;
+	/// Next created task
+	FreeRTOSTask *next = NULL;
 
 	/// FreeRTOS task entry point
 	static void taskBody(void *data);